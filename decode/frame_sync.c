@@ -0,0 +1,493 @@
+//--------------------------------------------------------------------
+// M17 C library - decode/frame_sync.c
+//
+// This file contains:
+// - streaming syncword detector, SIMD where available
+// - frame sync state machine: acquisition and tracking modes
+//
+// agent <agent@local>
+// M17 Project, 16 October 2026
+//--------------------------------------------------------------------
+#include <string.h>
+#include <math.h>
+#include "m17.h"
+
+#if defined(__SSE2__)
+#define M17_SYNC_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define M17_SYNC_NEON
+#include <arm_neon.h>
+#endif
+
+/**
+ * @brief Initialize a syncword detector.
+ * Syncword symbols are generated from `SYNC_LSF`, `SYNC_STR`, `SYNC_PKT`, `SYNC_BER` and `EOT_MRKR`.
+ * Tracking is enabled with `M17_SYNC_TRACK_WIN` and `M17_SYNC_TRACK_MISSES`.
+ *
+ * @param ctx Pointer to a detector context.
+ * @param thresh Detection threshold: maximum L2 norm between the received symbols and a syncword,
+ *   `M17_SYNC_DIST_MAX` is a sensible default.
+ * @param cb Callback fired for every detected frame, can be NULL.
+ * @param user User pointer passed to the callback.
+ */
+void sync_detect_init(sync_detect_t* ctx, float thresh, sync_cb_t cb, void* user)
+{
+    const uint16_t sync[M17_SYNC_TYPES]={SYNC_LSF, SYNC_STR, SYNC_PKT, SYNC_BER, EOT_MRKR};
+
+    memset(ctx, 0, sizeof(sync_detect_t));
+
+    for(uint8_t k=0; k<M17_SYNC_TYPES; k++)
+    {
+        uint32_t cnt=0;
+        gen_syncword(ctx->sync[k], &cnt, sync[k]);
+
+        for(uint8_t j=0; j<SYM_PER_SWD; j++)
+            ctx->nrm[k]+=ctx->sync[k][j]*ctx->sync[k][j];
+    }
+
+    ctx->pos=M17_SYNC_HIST;
+    ctx->thresh=thresh;
+    ctx->cb=cb;
+    ctx->user=user;
+    ctx->mode=SYNC_ACQUIRE;
+    ctx->window=M17_SYNC_TRACK_WIN;
+    ctx->max_misses=M17_SYNC_TRACK_MISSES;
+}
+
+/**
+ * @brief Clear the symbol history of a detector, e.g. on a channel change.
+ * The symbol counter restarts from 0 and the detector goes back to acquisition.
+ *
+ * @param ctx Pointer to a detector context.
+ */
+void sync_detect_reset(sync_detect_t* ctx)
+{
+    memset(ctx->buf, 0, sizeof(ctx->buf));
+    ctx->pos=M17_SYNC_HIST;
+    ctx->cnt=0;
+    ctx->skip=0;
+    ctx->mode=SYNC_ACQUIRE;
+    ctx->misses=0;
+}
+
+/**
+ * @brief Set up tracking mode.
+ * After a frame is detected, only the `2*window+1` offsets around the predicted
+ * next syncword, `SYM_PER_FRA` symbols later, are checked. A missed syncword
+ * moves the prediction one frame ahead, `max_misses` consecutive misses
+ * (or an EOT marker) switch the detector back to acquisition.
+ *
+ * @param ctx Pointer to a detector context.
+ * @param window Symbols checked on each side of the predicted syncword, up to `M17_SYNC_TRACK_WIN_MAX`.
+ * @param max_misses Missed syncwords before falling back to acquisition, 0 disables tracking.
+ * @return int8_t 0 on success, -1 on invalid window size.
+ */
+int8_t sync_detect_set_tracking(sync_detect_t* ctx, uint8_t window, uint8_t max_misses)
+{
+    if(window>M17_SYNC_TRACK_WIN_MAX)
+        return -1;
+
+    ctx->window=window;
+    ctx->max_misses=max_misses;
+
+    if(max_misses==0)
+        ctx->mode=SYNC_ACQUIRE;
+
+    return 0;
+}
+
+/**
+ * @brief Test 8 consecutive offsets against all syncwords.
+ * The squared distance to syncword k is |x|^2 - 2<x,s_k> + |s_k|^2, so only
+ * the window energy and one correlation per syncword are needed.
+ *
+ * @param x Symbols, the first window starts at x[0]. 15 symbols are read.
+ * @param ctx Pointer to a detector context.
+ * @param lim Per syncword |s_k|^2 - thresh^2.
+ * @return uint8_t Bit i is set if the window starting at x[i] is close enough to any syncword.
+ */
+static uint8_t scan_8(const float* x, const sync_detect_t* ctx, const float lim[M17_SYNC_TYPES])
+{
+#if defined(M17_SYNC_SSE2)
+    __m128 e0=_mm_setzero_ps(), e1=_mm_setzero_ps();
+    __m128 c0[M17_SYNC_TYPES], c1[M17_SYNC_TYPES];
+
+    for(uint8_t k=0; k<M17_SYNC_TYPES; k++)
+        c0[k]=c1[k]=_mm_setzero_ps();
+
+    for(uint8_t j=0; j<SYM_PER_SWD; j++)
+    {
+        __m128 v0=_mm_loadu_ps(&x[j]);
+        __m128 v1=_mm_loadu_ps(&x[j+4]);
+
+        e0=_mm_add_ps(e0, _mm_mul_ps(v0, v0));
+        e1=_mm_add_ps(e1, _mm_mul_ps(v1, v1));
+        for(uint8_t k=0; k<M17_SYNC_TYPES; k++)
+        {
+            __m128 s=_mm_set1_ps(ctx->sync[k][j]);
+
+            c0[k]=_mm_add_ps(c0[k], _mm_mul_ps(v0, s));
+            c1[k]=_mm_add_ps(c1[k], _mm_mul_ps(v1, s));
+        }
+    }
+
+    //distance below threshold <=> 2<x,s_k> > |x|^2 + |s_k|^2 - thresh^2
+    __m128 m0=_mm_setzero_ps(), m1=_mm_setzero_ps();
+
+    for(uint8_t k=0; k<M17_SYNC_TYPES; k++)
+    {
+        __m128 l=_mm_set1_ps(lim[k]);
+
+        m0=_mm_or_ps(m0, _mm_cmpgt_ps(_mm_add_ps(c0[k], c0[k]), _mm_add_ps(e0, l)));
+        m1=_mm_or_ps(m1, _mm_cmpgt_ps(_mm_add_ps(c1[k], c1[k]), _mm_add_ps(e1, l)));
+    }
+
+    return _mm_movemask_ps(m0) | (_mm_movemask_ps(m1)<<4);
+#elif defined(M17_SYNC_NEON)
+    float32x4_t e0=vdupq_n_f32(0), e1=vdupq_n_f32(0);
+    float32x4_t c0[M17_SYNC_TYPES], c1[M17_SYNC_TYPES];
+
+    for(uint8_t k=0; k<M17_SYNC_TYPES; k++)
+        c0[k]=c1[k]=vdupq_n_f32(0);
+
+    for(uint8_t j=0; j<SYM_PER_SWD; j++)
+    {
+        float32x4_t v0=vld1q_f32(&x[j]);
+        float32x4_t v1=vld1q_f32(&x[j+4]);
+
+        e0=vmlaq_f32(e0, v0, v0);
+        e1=vmlaq_f32(e1, v1, v1);
+        for(uint8_t k=0; k<M17_SYNC_TYPES; k++)
+        {
+            c0[k]=vmlaq_n_f32(c0[k], v0, ctx->sync[k][j]);
+            c1[k]=vmlaq_n_f32(c1[k], v1, ctx->sync[k][j]);
+        }
+    }
+
+    uint32x4_t m0=vdupq_n_u32(0), m1=vdupq_n_u32(0);
+
+    for(uint8_t k=0; k<M17_SYNC_TYPES; k++)
+    {
+        float32x4_t l=vdupq_n_f32(lim[k]);
+
+        m0=vorrq_u32(m0, vcgtq_f32(vaddq_f32(c0[k], c0[k]), vaddq_f32(e0, l)));
+        m1=vorrq_u32(m1, vcgtq_f32(vaddq_f32(c1[k], c1[k]), vaddq_f32(e1, l)));
+    }
+
+    uint32_t b[8];
+    vst1q_u32(&b[0], m0);
+    vst1q_u32(&b[4], m1);
+
+    uint8_t m=0;
+    for(uint8_t i=0; i<8; i++)
+        m|=(b[i]&1)<<i;
+
+    return m;
+#else
+    uint8_t m=0;
+
+    for(uint8_t i=0; i<8; i++)
+    {
+        float e=0;
+
+        for(uint8_t j=0; j<SYM_PER_SWD; j++)
+            e+=x[i+j]*x[i+j];
+
+        for(uint8_t k=0; k<M17_SYNC_TYPES; k++)
+        {
+            float c=0;
+
+            for(uint8_t j=0; j<SYM_PER_SWD; j++)
+                c+=x[i+j]*ctx->sync[k][j];
+
+            if(2.0f*c>e+lim[k])
+                m|=1<<i;
+        }
+    }
+
+    return m;
+#endif
+}
+
+/**
+ * @brief Find the closest syncword at a single offset.
+ *
+ * @param x Symbols.
+ * @param ctx Pointer to a detector context.
+ * @param dist Output: squared L2 norm to the closest syncword.
+ * @return syncword_t Closest syncword.
+ */
+static syncword_t closest_sync(const float* x, const sync_detect_t* ctx, float* dist)
+{
+    syncword_t best=SWD_LSF;
+
+    *dist=INFINITY;
+
+    for(uint8_t k=0; k<M17_SYNC_TYPES; k++)
+    {
+        float d=0;
+
+        for(uint8_t j=0; j<SYM_PER_SWD; j++)
+            d+=(x[j]-ctx->sync[k][j])*(x[j]-ctx->sync[k][j]);
+
+        if(d<*dist)
+        {
+            *dist=d;
+            best=(syncword_t)k;
+        }
+    }
+
+    return best;
+}
+
+/**
+ * @brief Find the closest syncword over a window of consecutive offsets.
+ *
+ * @param x Symbols, the first window starts at x[0]. `n` rounded up to a multiple of 4, plus 7 symbols are read.
+ * @param n Number of offsets.
+ * @param ctx Pointer to a detector context.
+ * @param hit Output: closest syncword and its squared L2 norm.
+ * @return uint8_t Offset of the closest match.
+ */
+static uint8_t closest_window(const float* x, uint8_t n, const sync_detect_t* ctx, sync_hit_t* hit)
+{
+    uint8_t best=0;
+
+    hit->dist=INFINITY;
+    hit->type=SWD_LSF;
+
+#if defined(M17_SYNC_SSE2)
+    for(uint8_t i=0; i<n; i+=4)
+    {
+        __m128 e=_mm_setzero_ps();
+        __m128 c[M17_SYNC_TYPES];
+
+        for(uint8_t k=0; k<M17_SYNC_TYPES; k++)
+            c[k]=_mm_setzero_ps();
+
+        for(uint8_t j=0; j<SYM_PER_SWD; j++)
+        {
+            __m128 v=_mm_loadu_ps(&x[i+j]);
+
+            e=_mm_add_ps(e, _mm_mul_ps(v, v));
+            for(uint8_t k=0; k<M17_SYNC_TYPES; k++)
+                c[k]=_mm_add_ps(c[k], _mm_mul_ps(v, _mm_set1_ps(ctx->sync[k][j])));
+        }
+
+        //per offset minimum over all syncwords, the type rides along as a float
+        __m128 dmin=_mm_set1_ps(INFINITY), tmin=_mm_setzero_ps();
+
+        for(uint8_t k=0; k<M17_SYNC_TYPES; k++)
+        {
+            __m128 d=_mm_sub_ps(_mm_add_ps(e, _mm_set1_ps(ctx->nrm[k])), _mm_add_ps(c[k], c[k]));
+            __m128 lt=_mm_cmplt_ps(d, dmin);
+
+            dmin=_mm_min_ps(d, dmin);
+            tmin=_mm_or_ps(_mm_and_ps(lt, _mm_set1_ps(k)), _mm_andnot_ps(lt, tmin));
+        }
+
+        float d[4], t[4];
+        _mm_storeu_ps(d, dmin);
+        _mm_storeu_ps(t, tmin);
+
+        for(uint8_t l=0; l<4 && i+l<n; l++)
+        {
+            if(d[l]<hit->dist)
+            {
+                hit->dist=d[l];
+                hit->type=(syncword_t)t[l];
+                best=i+l;
+            }
+        }
+    }
+#else
+    for(uint8_t i=0; i<n; i++)
+    {
+        float d;
+        syncword_t t=closest_sync(&x[i], ctx, &d);
+
+        if(d<hit->dist)
+        {
+            hit->dist=d;
+            hit->type=t;
+            best=i;
+        }
+    }
+#endif
+
+    return best;
+}
+
+/**
+ * @brief Report a detected frame.
+ *
+ * @param ctx Pointer to a detector context.
+ * @param hit Detection result, the squared distance is converted to L2 norm.
+ * @param x Frame symbols, starting with the syncword.
+ * @param offset Index of the first syncword symbol in the input stream.
+ */
+static void report_hit(sync_detect_t* ctx, sync_hit_t* hit, const float* x, uint32_t offset)
+{
+    hit->dist=sqrtf(hit->dist);
+    hit->offset=offset;
+
+    if(ctx->cb!=NULL)
+        ctx->cb(hit, &x[SYM_PER_SWD], ctx->user);
+}
+
+/**
+ * @brief Scan a contiguous run of symbols for syncwords.
+ * Offsets to skip are taken from the context, and the leftover is stored back.
+ *
+ * @param ctx Pointer to a detector context.
+ * @param x Symbols, a frame ending at the run's i-th symbol starts at x[i].
+ *   At least `2*M17_SYNC_TRACK_WIN_MAX` symbols before x[0] have to be readable.
+ * @param n Number of symbols in the run.
+ * @param lim Per syncword |s_k|^2 - thresh^2.
+ * @return uint32_t Number of detected frames.
+ */
+static uint32_t scan_run(sync_detect_t* ctx, const float* x, uint32_t n, const float lim[M17_SYNC_TYPES])
+{
+    const float t2=ctx->thresh*ctx->thresh;
+    const uint32_t start=ctx->cnt-(SYM_PER_FRA-1); //stream index of x[0]
+    int32_t s=ctx->skip;
+    uint32_t hits=0;
+
+    while(s<(int32_t)n)
+    {
+        sync_hit_t hit;
+
+        if(ctx->mode==SYNC_TRACK)
+        {
+            //the whole window has been received, s is its last offset
+            const int32_t w0=s-2*ctx->window;   //first offset of the window
+            const int32_t best=w0+closest_window(&x[w0], 2*ctx->window+1, ctx, &hit);
+
+            if(hit.dist<t2)
+            {
+                report_hit(ctx, &hit, &x[best], start+best);
+                hits++;
+                ctx->misses=0;
+
+                //end of transmission
+                if(hit.type==SWD_EOT)
+                {
+                    ctx->mode=SYNC_ACQUIRE;
+                    s=best+SYM_PER_FRA;
+                }
+                else
+                    s=best+SYM_PER_FRA+ctx->window;
+            }
+            else if(++ctx->misses<ctx->max_misses)
+            {
+                s+=SYM_PER_FRA;
+            }
+            else
+            {
+                ctx->mode=SYNC_ACQUIRE;
+                ctx->misses=0;
+                s++;
+            }
+
+            continue;
+        }
+
+        uint8_t m=scan_8(&x[s], ctx, lim);
+
+        if(n-s<8)
+            m&=(1<<(n-s))-1;
+
+        if(!m)
+        {
+            s=(n-s>8) ? s+8 : (int32_t)n;
+            continue;
+        }
+
+        //lowest set bit - verify it and find which syncword matched
+        uint8_t i=0;
+        while(!(m&(1<<i)))
+            i++;
+        s+=i;
+
+        hit.type=closest_sync(&x[s], ctx, &hit.dist);
+
+        if(hit.dist<t2)
+        {
+            report_hit(ctx, &hit, &x[s], start+s);
+            hits++;
+
+            if(ctx->max_misses && hit.type!=SWD_EOT)
+            {
+                ctx->mode=SYNC_TRACK;
+                ctx->misses=0;
+                s+=SYM_PER_FRA+ctx->window;
+            }
+            else
+                s+=SYM_PER_FRA;
+        }
+        else
+            s++;
+    }
+
+    ctx->skip=s-n;
+    ctx->cnt+=n;
+
+    return hits;
+}
+
+/**
+ * @brief Scan symbols for syncwords and fire the callback for every detected frame.
+ * A hit is reported once its whole frame has been received, so the callback gets
+ * the syncword's payload and can pass it directly to `decode_LSF()`,
+ * `decode_str_frame()` or `decode_pkt_frame()`.
+ * In acquisition, every symbol offset is tested against all syncwords at once.
+ * In tracking, only the window around the predicted syncword is checked and the
+ * closest match is reported - see `sync_detect_set_tracking()`. With tracking
+ * disabled, offsets overlapping a reported frame are not tested for another hit.
+ * State carries over between calls, the input can be split into blocks of any size.
+ * Blocks of up to `M17_SYNC_BUF-M17_SYNC_HIST` symbols are appended to the symbol history
+ * and scanned there. Larger blocks only have their first `M17_SYNC_HIST` symbols appended,
+ * frames lying entirely within the input are scanned in place.
+ *
+ * @param ctx Pointer to a detector context.
+ * @param in Input symbols, e.g. from `symbol_sync()`.
+ * @param len Number of input symbols.
+ * @return uint32_t Number of detected frames.
+ */
+uint32_t sync_detect(sync_detect_t* ctx, const float* in, uint32_t len)
+{
+    const uint8_t base=2*M17_SYNC_TRACK_WIN_MAX;    //extra history, a whole tracking window stays in the buffer
+    const uint16_t hist=M17_SYNC_HIST;              //symbols kept from previous calls
+    const uint16_t n=(len<=M17_SYNC_BUF-hist) ? len : hist; //input symbols appended to the history
+    const float t2=ctx->thresh*ctx->thresh;
+    float lim[M17_SYNC_TYPES];
+    uint32_t hits;
+
+    for(uint8_t k=0; k<M17_SYNC_TYPES; k++)
+        lim[k]=ctx->nrm[k]-t2;
+
+    //out of room - move the history to the front, once every few calls for small blocks
+    if(ctx->pos+n>M17_SYNC_BUF)
+    {
+        memmove(ctx->buf, &ctx->buf[ctx->pos-hist], hist*sizeof(float));
+        ctx->pos=hist;
+    }
+
+    //this covers all frames starting before this call
+    memcpy(&ctx->buf[ctx->pos], in, n*sizeof(float));
+    hits=scan_run(ctx, &ctx->buf[ctx->pos-hist+base], n, lim);
+    ctx->pos+=n;
+
+    //the rest of a large block lies entirely within the input, scanned in place
+    if(len>n)
+    {
+        hits+=scan_run(ctx, &in[base], len-n, lim);
+
+        //keep the last symbols for the next call
+        memcpy(ctx->buf, &in[len-hist], hist*sizeof(float));
+        ctx->pos=hist;
+    }
+
+    return hits;
+}
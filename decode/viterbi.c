@@ -11,27 +11,40 @@
 #include <string.h>
 #include "m17.h"
 
-static uint32_t metricsA[M17_CONVOL_STATES];
-static uint32_t metricsB[M17_CONVOL_STATES];
-static uint16_t viterbi_history[M17_VITERBI_HIST_LEN];
+//decoder context used by the legacy, non-reentrant API
+static viterbi_t viterbi_ctx =
+{
+    .prevMetrics = viterbi_ctx.metricsA,
+    .currMetrics = viterbi_ctx.metricsB
+};
 
-static uint32_t *prevMetrics = metricsA;
-static uint32_t *currMetrics = metricsB;
+/**
+ * @brief Initialize a Viterbi decoder context.
+ * Has to be called once before the context is used for the first time.
+ *
+ * @param ctx Pointer to a decoder context.
+ */
+void viterbi_init(viterbi_t* ctx)
+{
+    memset(ctx, 0, sizeof(viterbi_t));
+    viterbi_reset_ctx(ctx);
+}
 
 /**
  * @brief Decode unpunctured convolutionally encoded data.
  *
+ * @param ctx Pointer to a decoder context.
  * @param out Destination array where decoded data is written.
  * @param in Input data.
  * @param len Input length in bits.
  * @return Number of bit errors corrected.
  */
-uint32_t viterbi_decode(uint8_t* out, const uint16_t* in, uint16_t len)
+uint32_t viterbi_decode_ctx(viterbi_t* ctx, uint8_t* out, const uint16_t* in, uint16_t len)
 {
     if(len > M17_VITERBI_HIST_LEN_2)
 		return UINT32_MAX; //emit a large value
 
-    viterbi_reset();
+    viterbi_reset_ctx(ctx);
 
     size_t pos = 0;
     for(size_t i = 0; i < len; i += 2)
@@ -39,16 +52,17 @@ uint32_t viterbi_decode(uint8_t* out, const uint16_t* in, uint16_t len)
         uint16_t s0 = in[i];
         uint16_t s1 = in[i + 1];
 
-        viterbi_decode_bit(s0, s1, pos);
+        viterbi_decode_bit_ctx(ctx, s0, s1, pos);
         pos++;
     }
 
-    return viterbi_chainback(out, pos, len/2);
+    return viterbi_chainback_ctx(ctx, out, pos, len/2);
 }
 
 /**
  * @brief Decode punctured convolutionally encoded data.
  *
+ * @param ctx Pointer to a decoder context.
  * @param out Destination array where decoded data is written.
  * @param in Input data.
  * @param punct Puncturing matrix.
@@ -56,48 +70,93 @@ uint32_t viterbi_decode(uint8_t* out, const uint16_t* in, uint16_t len)
  * @param p_len Puncturing matrix length (entries).
  * @return Number of bit errors corrected.
  */
-uint32_t viterbi_decode_punctured(uint8_t* out, const uint16_t* in, const uint8_t* punct, uint16_t in_len, uint16_t p_len)
+uint32_t viterbi_decode_punctured_ctx(viterbi_t* ctx, uint8_t* out, const uint16_t* in, const uint8_t* punct, uint16_t in_len, uint16_t p_len)
 {
     if(in_len > M17_VITERBI_HIST_LEN_2)
 		return UINT32_MAX; //emit a large value
 
-	uint16_t umsg[M17_VITERBI_HIST_LEN_2];  //unpunctured message
+    if(ctx->opts & M17_VITERBI_OPT_SHORTCUT)
+    {
+        uint32_t e = viterbi_decode_punctured_shortcut(out, in, punct, in_len, p_len);
+
+        if(e != UINT32_MAX)
+        {
+            ctx->last_path = VITERBI_PATH_SHORTCUT;
+            ctx->path_cnt[VITERBI_PATH_SHORTCUT]++;
+            return e;
+        }
+    }
+
+    if(ctx->opts & M17_VITERBI_OPT_HARD)
+    {
+        uint32_t err = viterbi_decode_punctured_hard_ctx(ctx, out, in, punct, in_len, p_len);
+
+        //scaled to the soft metric, so that thresholds stay meaningful
+        if(err <= ctx->hard_max_err)
+        {
+            ctx->last_path = VITERBI_PATH_HARD;
+            ctx->path_cnt[VITERBI_PATH_HARD]++;
+            return err*0xFFFF;
+        }
+
+        //too many errors - soft decisions do better
+    }
+
+    ctx->last_path = VITERBI_PATH_SOFT;
+    ctx->path_cnt[VITERBI_PATH_SOFT]++;
+
+    viterbi_reset_ctx(ctx);
+
 	uint8_t p=0;		                    //puncturer matrix entry
 	uint16_t u=0;		                    //bits count - unpunctured message
     uint16_t i=0;                           //bits read from the input message
+    size_t pos=0;                           //decoder steps
 
+    //depuncture on the fly - erased bits enter the decoder as 0x7FFF
 	while(i<in_len)
 	{
-		if(punct[p])
-		{
-			umsg[u]=in[i];
-			i++;
-		}
-		else
-		{
-			umsg[u]=0x7FFF;
-		}
+        if(pos == M17_VITERBI_HIST_LEN)
+            return UINT32_MAX; //unpunctured message does not fit in the history
+
+        uint16_t s[2];
+
+        for(uint8_t k=0; k<2; k++)
+        {
+            //a trailing odd bit is padded with an erasure
+            if(i<in_len && punct[p])
+                s[k]=in[i++];
+            else
+                s[k]=0x7FFF;
 
-		u++;
-		p++;
-		p%=p_len;
+            u++;
+            p++;
+            p%=p_len;
+        }
+
+        viterbi_decode_bit_ctx(ctx, s[0], s[1], pos);
+        pos++;
 	}
 
-    return viterbi_decode(out, umsg, u) - (u-in_len)*0x7FFF;
+    //remove the nominal 0x7FFF cost of each erasure
+    return viterbi_chainback_ctx(ctx, out, pos, u/2) - (u-in_len)*0x7FFF;
 }
 
 /**
- * @brief Decode one bit and update trellis.
+ * @brief Scalar add-compare-select kernel - the reference implementation.
  *
+ * @param ctx Pointer to a decoder context.
  * @param s0 Cost of the first symbol.
  * @param s1 Cost of the second symbol.
  * @param pos Bit position in history.
  */
-void viterbi_decode_bit(uint16_t s0, uint16_t s1, size_t pos)
+static void acs_scalar(viterbi_t* ctx, uint16_t s0, uint16_t s1, size_t pos)
 {
     static const uint16_t COST_TABLE_0[] = {0, 0, 0, 0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF};
     static const uint16_t COST_TABLE_1[] = {0, 0xFFFF, 0xFFFF, 0, 0, 0xFFFF, 0xFFFF, 0};
 
+    uint32_t *prevMetrics = ctx->prevMetrics;
+    uint32_t *currMetrics = ctx->currMetrics;
+
     for(uint8_t i = 0; i < M17_CONVOL_STATES/2; i++)
     {
         uint16_t e0 = COST_TABLE_0[i];
@@ -117,86 +176,1708 @@ void viterbi_decode_bit(uint16_t s0, uint16_t s1, size_t pos)
 
         if(m0 >= m1)
         {
-            viterbi_history[pos]|=(1<<i0);
+            ctx->history[pos]|=(1<<i0);
             currMetrics[i0] = m1;
         }
         else
         {
-            viterbi_history[pos]&=~(1<<i0);
+            ctx->history[pos]&=~(1<<i0);
             currMetrics[i0] = m0;
         }
 
         if(m2 >= m3)
         {
-            viterbi_history[pos]|=(1<<i1);
+            ctx->history[pos]|=(1<<i1);
             currMetrics[i1] = m3;
         }
         else
         {
-            viterbi_history[pos]&=~(1<<i1);
+            ctx->history[pos]&=~(1<<i1);
             currMetrics[i1] = m2;
         }
     }
+}
 
-    //swap
-    uint32_t *tmp = prevMetrics;
-    prevMetrics = currMetrics;
-    currMetrics = tmp;
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define M17_VITERBI_X86
+#include <immintrin.h>
+
+/**
+ * @brief SSE2 add-compare-select kernel.
+ * Branch metrics for states i and i+8 are laid out in 4 lanes of 32 bits.
+ * Unsigned comparison is done on sign-flipped values.
+ *
+ * @param ctx Pointer to a decoder context.
+ * @param s0 Cost of the first symbol.
+ * @param s1 Cost of the second symbol.
+ * @param pos Bit position in history.
+ */
+__attribute__((target("sse2")))
+static void acs_sse2(viterbi_t* ctx, uint16_t s0, uint16_t s1, size_t pos)
+{
+    const int32_t a = s0, na = 0xFFFF - s0;
+    const int32_t b = s1, nb = 0xFFFF - s1;
+    const __m128i bias = _mm_set1_epi32((int32_t)0x80000000);
+    const __m128i bm_max = _mm_set1_epi32(0x1FFFE);
+
+    const __m128i *prev = (const __m128i*)ctx->prevMetrics;
+    __m128i *curr = (__m128i*)ctx->currMetrics;
+    uint16_t dec = 0;
+
+    for(uint8_t g = 0; g < 2; g++)
+    {
+        __m128i bm0 = (g==0) ? _mm_setr_epi32(a+b, a+nb, a+nb, a+b) : _mm_setr_epi32(na+b, na+nb, na+nb, na+b);
+        __m128i bm1 = _mm_sub_epi32(bm_max, bm0);
+
+        __m128i p_lo = _mm_loadu_si128(&prev[g]);
+        __m128i p_hi = _mm_loadu_si128(&prev[g+2]);
+
+        __m128i m0 = _mm_add_epi32(p_lo, bm0);
+        __m128i m1 = _mm_add_epi32(p_hi, bm1);
+        __m128i m2 = _mm_add_epi32(p_lo, bm1);
+        __m128i m3 = _mm_add_epi32(p_hi, bm0);
+
+        //lanes where the upper branch wins (m0 < m1), the decision bit is cleared there
+        __m128i sel_e = _mm_cmpgt_epi32(_mm_xor_si128(m1, bias), _mm_xor_si128(m0, bias));
+        __m128i sel_o = _mm_cmpgt_epi32(_mm_xor_si128(m3, bias), _mm_xor_si128(m2, bias));
+
+        __m128i even = _mm_or_si128(_mm_and_si128(sel_e, m0), _mm_andnot_si128(sel_e, m1));
+        __m128i odd  = _mm_or_si128(_mm_and_si128(sel_o, m2), _mm_andnot_si128(sel_o, m3));
+
+        _mm_storeu_si128(&curr[2*g],   _mm_unpacklo_epi32(even, odd));
+        _mm_storeu_si128(&curr[2*g+1], _mm_unpackhi_epi32(even, odd));
+
+        uint16_t d_lo = _mm_movemask_ps(_mm_castsi128_ps(_mm_unpacklo_epi32(sel_e, sel_o)));
+        uint16_t d_hi = _mm_movemask_ps(_mm_castsi128_ps(_mm_unpackhi_epi32(sel_e, sel_o)));
+
+        dec |= (uint16_t)((d_lo | (d_hi << 4)) << (8*g));
+    }
+
+    ctx->history[pos] = ~dec;
 }
 
 /**
- * @brief History chainback to obtain final byte array.
+ * @brief AVX2 add-compare-select kernel.
+ * All 8 butterflies are processed at once, in 8 lanes of 32 bits.
  *
- * @param out Destination byte array for decoded data.
- * @param pos Starting position for the chainback.
- * @param len Length of the output in bits (minus K-1=4).
- * @return Minimum Viterbi cost at the end of the decode sequence.
+ * @param ctx Pointer to a decoder context.
+ * @param s0 Cost of the first symbol.
+ * @param s1 Cost of the second symbol.
+ * @param pos Bit position in history.
  */
-uint32_t viterbi_chainback(uint8_t* out, size_t pos, uint16_t len)
+__attribute__((target("avx2")))
+static void acs_avx2(viterbi_t* ctx, uint16_t s0, uint16_t s1, size_t pos)
 {
-    uint8_t state = 0;
-    size_t bitPos = len+4;
+    const int32_t a = s0, na = 0xFFFF - s0;
+    const int32_t b = s1, nb = 0xFFFF - s1;
 
-    memset(out, 0, (bitPos/8)+1);
+    __m256i bm0 = _mm256_setr_epi32(a+b, a+nb, a+nb, a+b, na+b, na+nb, na+nb, na+b);
+    __m256i bm1 = _mm256_sub_epi32(_mm256_set1_epi32(0x1FFFE), bm0);
 
-    while(pos > 0)
+    __m256i p_lo = _mm256_loadu_si256((const __m256i*)&ctx->prevMetrics[0]);
+    __m256i p_hi = _mm256_loadu_si256((const __m256i*)&ctx->prevMetrics[M17_CONVOL_STATES/2]);
+
+    __m256i m0 = _mm256_add_epi32(p_lo, bm0);
+    __m256i m1 = _mm256_add_epi32(p_hi, bm1);
+    __m256i m2 = _mm256_add_epi32(p_lo, bm1);
+    __m256i m3 = _mm256_add_epi32(p_hi, bm0);
+
+    //on a tie the lower branch is taken, so the decision bit is set when min==m1
+    __m256i even = _mm256_min_epu32(m0, m1);
+    __m256i odd  = _mm256_min_epu32(m2, m3);
+    __m256i dec_e = _mm256_cmpeq_epi32(even, m1);
+    __m256i dec_o = _mm256_cmpeq_epi32(odd, m3);
+
+    //unpack works within 128-bit halves, so the halves have to be swapped afterwards
+    __m256i lo = _mm256_unpacklo_epi32(even, odd);
+    __m256i hi = _mm256_unpackhi_epi32(even, odd);
+    _mm256_storeu_si256((__m256i*)&ctx->currMetrics[0], _mm256_permute2x128_si256(lo, hi, 0x20));
+    _mm256_storeu_si256((__m256i*)&ctx->currMetrics[M17_CONVOL_STATES/2], _mm256_permute2x128_si256(lo, hi, 0x31));
+
+    lo = _mm256_unpacklo_epi32(dec_e, dec_o);
+    hi = _mm256_unpackhi_epi32(dec_e, dec_o);
+    uint32_t d_lo = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_permute2x128_si256(lo, hi, 0x20)));
+    uint32_t d_hi = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_permute2x128_si256(lo, hi, 0x31)));
+
+    ctx->history[pos] = d_lo | (d_hi << 8);
+}
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define M17_VITERBI_NEON
+#include <arm_neon.h>
+
+/**
+ * @brief Collapse 4 all-ones/all-zeros lanes into a 4-bit mask.
+ *
+ * @param d Comparison result.
+ * @return uint16_t Bitmask, lane 0 at bit 0.
+ */
+static inline uint16_t neon_movemask(uint32x4_t d)
+{
+    static const uint32_t weights[4] = {1, 2, 4, 8};
+
+    uint32x4_t m = vandq_u32(d, vld1q_u32(weights));
+    uint32x2_t s = vadd_u32(vget_low_u32(m), vget_high_u32(m));
+    s = vpadd_u32(s, s);
+
+    return vget_lane_u32(s, 0);
+}
+
+/**
+ * @brief NEON add-compare-select kernel.
+ * Same data layout as the SSE2 kernel.
+ *
+ * @param ctx Pointer to a decoder context.
+ * @param s0 Cost of the first symbol.
+ * @param s1 Cost of the second symbol.
+ * @param pos Bit position in history.
+ */
+static void acs_neon(viterbi_t* ctx, uint16_t s0, uint16_t s1, size_t pos)
+{
+    const uint32_t a = s0, na = 0xFFFF - s0;
+    const uint32_t b = s1, nb = 0xFFFF - s1;
+    const uint32_t bm_lo[4] = {a+b, a+nb, a+nb, a+b};
+    const uint32_t bm_hi[4] = {na+b, na+nb, na+nb, na+b};
+    uint16_t dec = 0;
+
+    for(uint8_t g = 0; g < 2; g++)
     {
-        bitPos--;
-        pos--;
-        uint16_t bit = viterbi_history[pos]&((1<<(state>>4)));
-        state >>= 1;
-        if(bit)
+        uint32x4_t bm0 = vld1q_u32(g==0 ? bm_lo : bm_hi);
+        uint32x4_t bm1 = vsubq_u32(vdupq_n_u32(0x1FFFE), bm0);
+
+        uint32x4_t p_lo = vld1q_u32(&ctx->prevMetrics[4*g]);
+        uint32x4_t p_hi = vld1q_u32(&ctx->prevMetrics[4*g + M17_CONVOL_STATES/2]);
+
+        uint32x4_t m0 = vaddq_u32(p_lo, bm0);
+        uint32x4_t m1 = vaddq_u32(p_hi, bm1);
+        uint32x4_t m2 = vaddq_u32(p_lo, bm1);
+        uint32x4_t m3 = vaddq_u32(p_hi, bm0);
+
+        uint32x4x2_t metrics = vzipq_u32(vminq_u32(m0, m1), vminq_u32(m2, m3));
+        uint32x4x2_t decisions = vzipq_u32(vcgeq_u32(m0, m1), vcgeq_u32(m2, m3));
+
+        vst1q_u32(&ctx->currMetrics[8*g],   metrics.val[0]);
+        vst1q_u32(&ctx->currMetrics[8*g+4], metrics.val[1]);
+
+        dec |= (uint16_t)((neon_movemask(decisions.val[0]) | (neon_movemask(decisions.val[1]) << 4)) << (8*g));
+    }
+
+    ctx->history[pos] = dec;
+}
+#endif
+
+/**
+ * @brief Decode punctured convolutionally encoded data without running the trellis.
+ * The input bits are recovered from the hard decisions by inverting the code
+ * (from G1, or from G2 where G1 is punctured), then re-encoded and compared
+ * with the received bits. This only succeeds if every received bit matches,
+ * the message ends with K-1 zero flushing bits, and no other path can beat
+ * this one on soft metrics. Output and metric are then identical to
+ * those of `viterbi_decode_punctured_ctx()`.
+ *
+ * @param out Destination array where decoded data is written.
+ * @param in Input data.
+ * @param punct Puncturing matrix.
+ * @param in_len Input data length.
+ * @param p_len Puncturing matrix length (entries).
+ * @return uint32_t Viterbi metric, UINT32_MAX if the full decoder is needed.
+ */
+uint32_t viterbi_decode_punctured_shortcut(uint8_t* out, const uint16_t* in, const uint8_t* punct, uint16_t in_len, uint16_t p_len)
+{
+    if(in_len > M17_VITERBI_HIST_LEN_2)
+		return UINT32_MAX; //emit a large value
+
+	uint8_t p=0;		                    //puncturer matrix entry
+    uint16_t i=0;                           //bits read from the input message
+    uint16_t steps=0;                       //decoder steps
+    uint8_t reg=0;                          //last 4 input bits, newest at bit 0
+    uint32_t cost=0;                        //metric of the received bits
+    uint16_t margin=0xFFFF;                 //smallest metric penalty of flipping a received bit
+    uint16_t ones=0;                        //erasures in place of a 1 (cost 0x8000 instead of 0x7FFF)
+    uint8_t dec[(M17_VITERBI_HIST_LEN+8+7)/8] = {0}; //same layout as the chainback output
+
+    while(i<in_len)
+    {
+        if(steps == M17_VITERBI_HIST_LEN)
+            return UINT32_MAX; //unpunctured message does not fit in the history
+
+        uint16_t s[2];
+        uint8_t present[2];
+
+        for(uint8_t k=0; k<2; k++)
         {
-        	state |= 0x80;
-        	out[bitPos/8]|=1<<(7-(bitPos%8));
-		}
+            present[k] = (i<in_len && punct[p]);
+            s[k] = present[k] ? in[i++] : 0x7FFF;
+
+            if(++p == p_len)
+                p = 0;
+        }
+
+        //invert the code: G1=x+x[-3]+x[-4], G2=x+x[-1]+x[-2]+x[-4]
+        uint8_t x;
+
+        if(present[0])
+            x = (s[0]>>15) ^ (reg>>2) ^ (reg>>3);
+        else if(present[1])
+            x = (s[1]>>15) ^ reg ^ (reg>>1) ^ (reg>>3);
+        else
+            return UINT32_MAX;
+
+        x &= 1;
+
+        //re-encode and compare
+        uint8_t g[2];
+        g[0] = (x ^ (reg>>2) ^ (reg>>3)) & 1;
+        g[1] = (x ^ reg ^ (reg>>1) ^ (reg>>3)) & 1;
+
+        for(uint8_t k=0; k<2; k++)
+        {
+            if(present[k])
+            {
+                if(g[k] != (s[k]>>15))
+                    return UINT32_MAX;
+
+                uint16_t d = g[k] ? 0xFFFF-s[k] : s[k];
+                uint16_t pen = 0xFFFF - 2*d;
+
+                cost += d;
+                if(pen < margin) margin = pen;
+            }
+            else
+            {
+                ones += g[k];
+            }
+        }
+
+        dec[(steps+8)/8] |= x<<(7-((steps+8)%8));
+        reg = ((reg<<1) | x) & 0xF;
+        steps++;
     }
 
-    uint32_t cost = prevMetrics[0];
+    //the trellis has to end in state 0
+    if(reg != 0)
+        return UINT32_MAX;
 
-    for(size_t i = 0; i < M17_CONVOL_STATES; i++)
+    //any other path flips at least one received bit, so it costs at least
+    //`margin` more there, and saves at most `ones` on the erasures
+    if(margin <= ones)
+        return UINT32_MAX;
+
+    //the flushing bits are zero, so they can be copied along
+    memcpy(out, dec, (steps+4+7)/8);
+
+    return cost + ones;
+}
+
+/**
+ * @brief Scalar hard decision trellis - the reference implementation.
+ *
+ * @param history Decision history, one entry per step.
+ * @param metrics Path metrics, updated in place.
+ * @param sym Packed received symbol pairs, one per step.
+ * @param steps Number of trellis steps.
+ * @param bm Branch metrics of every packed symbol pair, for both branches of the 8 butterflies.
+ */
+static void trellis_hard_scalar(uint16_t* history, uint16_t* metrics, const uint8_t* sym, uint16_t steps, const uint16_t (*bm)[2][M17_CONVOL_STATES/2])
+{
+    uint16_t prev[M17_CONVOL_STATES];
+
+    for(uint16_t pos = 0; pos < steps; pos++)
     {
-        uint32_t m = prevMetrics[i];
-        if(m < cost) cost = m;
+        const uint16_t *bm0 = bm[sym[pos]][0];
+        const uint16_t *bm1 = bm[sym[pos]][1];
+        uint16_t dec = 0;
+
+        memcpy(prev, metrics, sizeof(prev));
+
+        for(uint8_t i = 0; i < M17_CONVOL_STATES/2; i++)
+        {
+            uint16_t m0 = prev[i] + bm0[i];
+            uint16_t m1 = prev[i + M17_CONVOL_STATES/2] + bm1[i];
+            uint16_t m2 = prev[i] + bm1[i];
+            uint16_t m3 = prev[i + M17_CONVOL_STATES/2] + bm0[i];
+
+            metrics[2*i]   = (m0 >= m1) ? m1 : m0;
+            metrics[2*i+1] = (m2 >= m3) ? m3 : m2;
+            dec |= ((m0 >= m1) << (2*i)) | ((m2 >= m3) << (2*i+1));
+        }
+
+        history[pos] = dec;
     }
+}
 
-    return cost;
+#ifdef M17_VITERBI_X86
+/**
+ * @brief SSE2 hard decision trellis.
+ * All 8 butterflies are processed at once, in 8 lanes of 16 bits,
+ * and the metrics stay in registers for the whole message.
+ * Metrics stay below 0x8000, so signed comparisons are safe.
+ *
+ * @param history Decision history, one entry per step.
+ * @param metrics Path metrics, updated in place.
+ * @param sym Packed received symbol pairs, one per step.
+ * @param steps Number of trellis steps.
+ * @param bm Branch metrics of every packed symbol pair, for both branches of the 8 butterflies.
+ */
+__attribute__((target("sse2")))
+static void trellis_hard_sse2(uint16_t* history, uint16_t* metrics, const uint8_t* sym, uint16_t steps, const uint16_t (*bm)[2][M17_CONVOL_STATES/2])
+{
+    __m128i p_lo = _mm_loadu_si128((const __m128i*)&metrics[0]);
+    __m128i p_hi = _mm_loadu_si128((const __m128i*)&metrics[M17_CONVOL_STATES/2]);
+
+    for(uint16_t pos = 0; pos < steps; pos++)
+    {
+        __m128i bm0 = _mm_loadu_si128((const __m128i*)bm[sym[pos]][0]);
+        __m128i bm1 = _mm_loadu_si128((const __m128i*)bm[sym[pos]][1]);
+
+        __m128i m0 = _mm_add_epi16(p_lo, bm0);
+        __m128i m1 = _mm_add_epi16(p_hi, bm1);
+        __m128i m2 = _mm_add_epi16(p_lo, bm1);
+        __m128i m3 = _mm_add_epi16(p_hi, bm0);
+
+        __m128i even = _mm_min_epi16(m0, m1);
+        __m128i odd  = _mm_min_epi16(m2, m3);
+        __m128i dec_e = _mm_cmpeq_epi16(even, m1);
+        __m128i dec_o = _mm_cmpeq_epi16(odd, m3);
+
+        p_lo = _mm_unpacklo_epi16(even, odd);
+        p_hi = _mm_unpackhi_epi16(even, odd);
+
+        history[pos] = _mm_movemask_epi8(_mm_packs_epi16(_mm_unpacklo_epi16(dec_e, dec_o), _mm_unpackhi_epi16(dec_e, dec_o)));
+    }
+
+    _mm_storeu_si128((__m128i*)&metrics[0], p_lo);
+    _mm_storeu_si128((__m128i*)&metrics[M17_CONVOL_STATES/2], p_hi);
 }
+#endif
 
+#ifdef M17_VITERBI_NEON
 /**
- * @brief Reset the decoder state. No args.
+ * @brief NEON hard decision trellis.
+ * Same data layout as the SSE2 version.
  *
+ * @param history Decision history, one entry per step.
+ * @param metrics Path metrics, updated in place.
+ * @param sym Packed received symbol pairs, one per step.
+ * @param steps Number of trellis steps.
+ * @param bm Branch metrics of every packed symbol pair, for both branches of the 8 butterflies.
  */
-void viterbi_reset(void)
+static void trellis_hard_neon(uint16_t* history, uint16_t* metrics, const uint8_t* sym, uint16_t steps, const uint16_t (*bm)[2][M17_CONVOL_STATES/2])
 {
-    memset(viterbi_history, 0, sizeof(viterbi_history));
+    //even states get weights 4^i, odd states 2*4^i
+    static const uint16_t weights[8] = {1, 4, 16, 64, 256, 1024, 4096, 16384};
+    const uint16x8_t w_e = vld1q_u16(weights);
+    const uint16x8_t w_o = vshlq_n_u16(w_e, 1);
 
-    // initialize all states to a large cost
-    for (uint8_t i = 0; i < M17_CONVOL_STATES; i++)
-        prevMetrics[i] = 0x3FFFFFFF;
+    uint16x8_t p_lo = vld1q_u16(&metrics[0]);
+    uint16x8_t p_hi = vld1q_u16(&metrics[M17_CONVOL_STATES/2]);
 
-    // only state 0 is valid at start
-    prevMetrics[0] = 0;
+    for(uint16_t pos = 0; pos < steps; pos++)
+    {
+        uint16x8_t bm0 = vld1q_u16(bm[sym[pos]][0]);
+        uint16x8_t bm1 = vld1q_u16(bm[sym[pos]][1]);
 
-    // currMetrics can be anything - will be overwritten
+        uint16x8_t m0 = vaddq_u16(p_lo, bm0);
+        uint16x8_t m1 = vaddq_u16(p_hi, bm1);
+        uint16x8_t m2 = vaddq_u16(p_lo, bm1);
+        uint16x8_t m3 = vaddq_u16(p_hi, bm0);
+
+        uint16x8x2_t next = vzipq_u16(vminq_u16(m0, m1), vminq_u16(m2, m3));
+        p_lo = next.val[0];
+        p_hi = next.val[1];
+
+        uint16x8_t d = vorrq_u16(vandq_u16(vcgeq_u16(m0, m1), w_e), vandq_u16(vcgeq_u16(m2, m3), w_o));
+        uint64x2_t s = vpaddlq_u32(vpaddlq_u16(d));
+
+        history[pos] = (uint16_t)(vgetq_lane_u64(s, 0) + vgetq_lane_u64(s, 1));
+    }
+
+    vst1q_u16(&metrics[0], p_lo);
+    vst1q_u16(&metrics[M17_CONVOL_STATES/2], p_hi);
+}
+#endif
+
+/**
+ * @brief Decode punctured convolutionally encoded data using hard decisions.
+ * Soft bits are sliced into bit-packed symbol pairs and erasure masks first,
+ * branch metrics are Hamming distances computed with XOR and popcount.
+ *
+ * @param ctx Pointer to a decoder context.
+ * @param out Destination array where decoded data is written.
+ * @param in Input data.
+ * @param punct Puncturing matrix.
+ * @param in_len Input data length.
+ * @param p_len Puncturing matrix length (entries).
+ * @return uint32_t Number of hard bit errors corrected, UINT32_MAX on invalid input length.
+ */
+uint32_t viterbi_decode_punctured_hard_ctx(viterbi_t* ctx, uint8_t* out, const uint16_t* in, const uint8_t* punct, uint16_t in_len, uint16_t p_len)
+{
+    static const uint8_t POPCNT_TABLE[] = {0, 1, 1, 2};
+    static const uint8_t EXP_TABLE[] = {0, 1, 1, 0, 2, 3, 3, 2}; //(G1<<1)|G2 of each butterfly
+
+    if(in_len > M17_VITERBI_HIST_LEN_2)
+		return UINT32_MAX; //emit a large value
+
+    if(ctx->kernel == VITERBI_KERNEL_AUTO)
+        viterbi_set_kernel(ctx, VITERBI_KERNEL_AUTO);
+
+    //pack: bits 1..0 are the received pair (first bit at bit 1), bits 3..2 mark the bits present
+    uint8_t sym[M17_VITERBI_HIST_LEN];
+	uint8_t p=0;		                    //puncturer matrix entry
+    uint16_t i=0;                           //bits read from the input message
+    uint16_t steps=0;
+
+    while(i<in_len)
+    {
+        if(steps == M17_VITERBI_HIST_LEN)
+            return UINT32_MAX; //unpunctured message does not fit in the history
+
+        uint8_t s=0;
+
+        for(uint8_t k=0; k<2; k++)
+        {
+            if(i<in_len && punct[p])
+            {
+                s |= ((in[i]>>15) << (1-k)) | (1 << (3-k));
+                i++;
+            }
+
+            if(++p == p_len)
+                p = 0;
+        }
+
+        sym[steps++]=s;
+    }
+
+    //branch metrics of all 16 packed pairs: Hamming distance over the bits present
+    uint16_t bm[16][2][M17_CONVOL_STATES/2];
+
+    for(uint8_t s=0; s<16; s++)
+    {
+        for(uint8_t j=0; j<M17_CONVOL_STATES/2; j++)
+        {
+            bm[s][0][j] = POPCNT_TABLE[((s & 3) ^ EXP_TABLE[j]) & (s >> 2)];
+            bm[s][1][j] = POPCNT_TABLE[s >> 2] - bm[s][0][j];
+        }
+    }
+
+    //only state 0 is valid at start
+    uint16_t metrics[M17_CONVOL_STATES];
+
+    for(uint8_t j=0; j<M17_CONVOL_STATES; j++)
+        metrics[j]=0x3FFF;
+    metrics[0]=0;
+
+    switch(ctx->kernel)
+    {
+#ifdef M17_VITERBI_X86
+        case VITERBI_KERNEL_SSE2:
+        case VITERBI_KERNEL_AVX2:
+            trellis_hard_sse2(ctx->history, metrics, sym, steps, (const uint16_t (*)[2][M17_CONVOL_STATES/2])bm);
+        break;
+#endif
+
+#ifdef M17_VITERBI_NEON
+        case VITERBI_KERNEL_NEON:
+            trellis_hard_neon(ctx->history, metrics, sym, steps, (const uint16_t (*)[2][M17_CONVOL_STATES/2])bm);
+        break;
+#endif
+
+        default:
+            trellis_hard_scalar(ctx->history, metrics, sym, steps, (const uint16_t (*)[2][M17_CONVOL_STATES/2])bm);
+        break;
+    }
+
+    //hand the final metrics over to the chainback
+    ctx->prevMetrics = ctx->metricsA;
+    ctx->currMetrics = ctx->metricsB;
+    for(uint8_t j=0; j<M17_CONVOL_STATES; j++)
+        ctx->prevMetrics[j]=metrics[j];
+
+    return viterbi_chainback_ctx(ctx, out, steps, steps);
+}
+
+/**
+ * @brief Scalar 8-bit LLR trellis - the reference implementation.
+ * Metrics are renormalized to a minimum of 0 every K-1=4 steps. Branch metrics
+ * are at most 28, so after the first K-1 steps no metric is more than 112 above
+ * the minimum, no metric exceeds 224 between renormalizations and the saturating
+ * 8-bit arithmetic is exact.
+ *
+ * @param history Decision history, one entry per step.
+ * @param metrics Path metrics, updated in place.
+ * @param q Costs of expecting a 0 for both bits of every step, 0..14. Expecting a 1 costs 14-q.
+ * @param steps Number of trellis steps.
+ * @return uint32_t Sum of the renormalization offsets.
+ */
+static uint32_t trellis_llr_scalar(uint16_t* history, uint8_t* metrics, const uint8_t (*q)[2], uint16_t steps)
+{
+    static const uint8_t EXP_TABLE[] = {0, 1, 1, 0, 2, 3, 3, 2}; //(G1<<1)|G2 of each butterfly
+    uint8_t prev[M17_CONVOL_STATES];
+    uint32_t acc = 0;
+
+    for(uint16_t pos = 0; pos < steps; pos++)
+    {
+        uint16_t dec = 0;
+        uint8_t min = 0xFF;
+
+        memcpy(prev, metrics, sizeof(prev));
+
+        for(uint8_t i = 0; i < M17_CONVOL_STATES/2; i++)
+        {
+            uint8_t bm0 = ((EXP_TABLE[i]>>1) ? 14-q[pos][0] : q[pos][0]) + ((EXP_TABLE[i]&1) ? 14-q[pos][1] : q[pos][1]);
+            uint8_t bm1 = 28 - bm0;
+
+            uint16_t m0 = prev[i] + bm0;
+            uint16_t m1 = prev[i + M17_CONVOL_STATES/2] + bm1;
+            uint16_t m2 = prev[i] + bm1;
+            uint16_t m3 = prev[i + M17_CONVOL_STATES/2] + bm0;
+
+            //saturate
+            if(m0 > 0xFF) m0 = 0xFF;
+            if(m1 > 0xFF) m1 = 0xFF;
+            if(m2 > 0xFF) m2 = 0xFF;
+            if(m3 > 0xFF) m3 = 0xFF;
+
+            metrics[2*i]   = (m0 >= m1) ? m1 : m0;
+            metrics[2*i+1] = (m2 >= m3) ? m3 : m2;
+            dec |= ((m0 >= m1) << (2*i)) | ((m2 >= m3) << (2*i+1));
+        }
+
+        history[pos] = dec;
+
+        if((pos & 3) != 3)
+            continue;
+
+        for(uint8_t i = 0; i < M17_CONVOL_STATES; i++)
+            if(metrics[i] < min) min = metrics[i];
+        for(uint8_t i = 0; i < M17_CONVOL_STATES; i++)
+            metrics[i] -= min;
+
+        acc += min;
+    }
+
+    return acc;
+}
+
+#ifdef M17_VITERBI_X86
+/**
+ * @brief SSE2 8-bit LLR trellis.
+ * All 16 metrics live in one register: lanes 0..7 hold states 0..7, lanes 8..15 states 8..15,
+ * so both halves of every butterfly are computed at once and swapping the halves
+ * lines the two candidates of each state up for the compare-select.
+ *
+ * @param history Decision history, one entry per step.
+ * @param metrics Path metrics, updated in place.
+ * @param q Costs of expecting a 0 for both bits of every step, 0..14. Expecting a 1 costs 14-q.
+ * @param steps Number of trellis steps.
+ * @return uint32_t Sum of the renormalization offsets.
+ */
+__attribute__((target("sse2")))
+static uint32_t trellis_llr_sse2(uint16_t* history, uint8_t* metrics, const uint8_t (*q)[2], uint16_t steps)
+{
+    //expected bits of the 8 butterflies: lanes 0..7 for the first branch, 8..15 for the second (complemented)
+    const __m128i exp0 = _mm_setr_epi8(0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0);
+    const __m128i exp1 = _mm_setr_epi8(0, 14, 14, 0, 0, 14, 14, 0, 14, 0, 0, 14, 14, 0, 0, 14);
+    __m128i p = _mm_loadu_si128((const __m128i*)metrics);
+    __m128i acc = _mm_setzero_si128();
+
+    for(uint16_t pos = 0; pos < steps; pos++)
+    {
+        __m128i q0 = _mm_set1_epi8(q[pos][0]);
+        __m128i q1 = _mm_set1_epi8(q[pos][1]);
+
+        //|q-exp|
+        __m128i bm = _mm_add_epi8(_mm_or_si128(_mm_subs_epu8(q0, exp0), _mm_subs_epu8(exp0, q0)),
+            _mm_or_si128(_mm_subs_epu8(q1, exp1), _mm_subs_epu8(exp1, q1)));
+        __m128i bm_s = _mm_shuffle_epi32(bm, 0x4E);
+
+        __m128i x = _mm_adds_epu8(p, bm);       //m0 | m1
+        __m128i y = _mm_adds_epu8(p, bm_s);     //m2 | m3
+        __m128i x_s = _mm_shuffle_epi32(x, 0x4E);
+        __m128i y_s = _mm_shuffle_epi32(y, 0x4E);
+
+        __m128i even = _mm_min_epu8(x, x_s);
+        __m128i odd  = _mm_min_epu8(y, y_s);
+        __m128i dec = _mm_unpacklo_epi8(_mm_cmpeq_epi8(even, x_s), _mm_cmpeq_epi8(odd, y_s));
+
+        p = _mm_unpacklo_epi8(even, odd);
+        history[pos] = _mm_movemask_epi8(dec);
+
+        if((pos & 3) != 3)
+            continue;
+
+        //renormalize - the minimum is broadcast to all lanes without leaving the register
+        __m128i t = _mm_min_epu8(p, _mm_shuffle_epi32(p, 0x4E));
+        t = _mm_min_epu8(t, _mm_shuffle_epi32(t, 0xB1));
+        t = _mm_min_epu8(t, _mm_shufflelo_epi16(_mm_shufflehi_epi16(t, 0xB1), 0xB1));
+        t = _mm_min_epu8(t, _mm_or_si128(_mm_slli_epi16(t, 8), _mm_srli_epi16(t, 8)));
+
+        p = _mm_subs_epu8(p, t);
+        acc = _mm_add_epi16(acc, _mm_srli_epi16(t, 8));
+    }
+
+    _mm_storeu_si128((__m128i*)metrics, p);
+
+    return (uint16_t)_mm_cvtsi128_si32(acc); //at most 28 per step, fits in 16 bits
+}
+#endif
+
+/**
+ * @brief Decode punctured convolutionally encoded int8 LLR data.
+ * LLRs are quantized to 15 levels and decoded with 8-bit saturating metrics,
+ * 16 states per SIMD register. The context's options do not apply.
+ *
+ * @param ctx Pointer to a decoder context.
+ * @param out Destination array where decoded data is written.
+ * @param in Input LLRs, -M17_LLR_MAX (certain 0) .. +M17_LLR_MAX (certain 1).
+ * @param punct Puncturing matrix.
+ * @param in_len Input data length.
+ * @param p_len Puncturing matrix length (entries).
+ * @return uint32_t Path metric, 14 per fully flipped bit. UINT32_MAX on invalid input length.
+ */
+uint32_t viterbi_decode_punctured_llr(viterbi_t* ctx, uint8_t* out, const int8_t* in, const uint8_t* punct, uint16_t in_len, uint16_t p_len)
+{
+    if(in_len > M17_VITERBI_HIST_LEN_2)
+		return UINT32_MAX; //emit a large value
+
+    if(ctx->kernel == VITERBI_KERNEL_AUTO)
+        viterbi_set_kernel(ctx, VITERBI_KERNEL_AUTO);
+
+    //depuncture and quantize to 0..14 - erased bits cost 7 either way
+    uint8_t q[M17_VITERBI_HIST_LEN][2];
+    uint8_t* qp = &q[0][0];
+	uint8_t p=0;		                    //puncturer matrix entry
+    uint16_t i=0;                           //bits read from the input message
+    uint16_t u=0;                           //bits count - unpunctured message
+
+    while(i<in_len)
+    {
+        if(u == M17_VITERBI_HIST_LEN_2)
+            return UINT32_MAX; //unpunctured message does not fit in the history
+
+        //branchless - in[i] is always valid here
+        uint8_t v = (uint8_t)(((in[i]+128)*15)>>8);
+
+        qp[u++] = punct[p] ? v : 7;
+        i += punct[p] ? 1 : 0;
+
+        if(++p == p_len)
+            p = 0;
+    }
+
+    //a trailing odd bit is padded with an erasure
+    if(u&1)
+        qp[u++] = 7;
+
+    uint16_t steps = u/2;
+
+    //only state 0 is valid at start
+    uint8_t metrics[M17_CONVOL_STATES];
+    uint32_t acc;
+
+    memset(metrics, 0xFF, sizeof(metrics));
+    metrics[0]=0;
+
+    switch(ctx->kernel)
+    {
+#ifdef M17_VITERBI_X86
+        case VITERBI_KERNEL_SSE2:
+        case VITERBI_KERNEL_AVX2:
+            acc = trellis_llr_sse2(ctx->history, metrics, (const uint8_t (*)[2])q, steps);
+        break;
+#endif
+
+        default:
+            acc = trellis_llr_scalar(ctx->history, metrics, (const uint8_t (*)[2])q, steps);
+        break;
+    }
+
+    //hand the final metrics over to the chainback
+    ctx->prevMetrics = ctx->metricsA;
+    ctx->currMetrics = ctx->metricsB;
+    for(uint8_t j=0; j<M17_CONVOL_STATES; j++)
+        ctx->prevMetrics[j]=acc+metrics[j];
+
+    //remove the nominal cost of 7 of each erasure
+    return viterbi_chainback_ctx(ctx, out, steps, steps) - (u-in_len)*7;
+}
+
+/**
+ * @brief Decode one bit and update trellis.
+ *
+ * @param ctx Pointer to a decoder context.
+ * @param s0 Cost of the first symbol.
+ * @param s1 Cost of the second symbol.
+ * @param pos Bit position in history.
+ */
+void viterbi_decode_bit_ctx(viterbi_t* ctx, uint16_t s0, uint16_t s1, size_t pos)
+{
+    switch(ctx->kernel)
+    {
+#ifdef M17_VITERBI_X86
+        case VITERBI_KERNEL_SSE2:
+            acs_sse2(ctx, s0, s1, pos);
+        break;
+
+        case VITERBI_KERNEL_AVX2:
+            acs_avx2(ctx, s0, s1, pos);
+        break;
+#endif
+
+#ifdef M17_VITERBI_NEON
+        case VITERBI_KERNEL_NEON:
+            acs_neon(ctx, s0, s1, pos);
+        break;
+#endif
+
+        default:
+            acs_scalar(ctx, s0, s1, pos);
+        break;
+    }
+
+    //swap
+    uint32_t *tmp = ctx->prevMetrics;
+    ctx->prevMetrics = ctx->currMetrics;
+    ctx->currMetrics = tmp;
+}
+
+/**
+ * @brief History chainback to obtain final byte array.
+ *
+ * @param ctx Pointer to a decoder context.
+ * @param out Destination byte array for decoded data.
+ * @param pos Starting position for the chainback.
+ * @param len Length of the output in bits (minus K-1=4).
+ * @return Minimum Viterbi cost at the end of the decode sequence.
+ */
+uint32_t viterbi_chainback_ctx(viterbi_t* ctx, uint8_t* out, size_t pos, uint16_t len)
+{
+    uint8_t state = 0;
+    size_t bitPos = len+4;
+
+    memset(out, 0, (bitPos+7)/8);
+
+    while(pos > 0)
+    {
+        bitPos--;
+        pos--;
+        uint16_t bit = ctx->history[pos]&((1<<(state>>4)));
+        state >>= 1;
+        if(bit)
+        {
+        	state |= 0x80;
+        	out[bitPos/8]|=1<<(7-(bitPos%8));
+		}
+    }
+
+    uint32_t cost = ctx->prevMetrics[0];
+
+    for(size_t i = 0; i < M17_CONVOL_STATES; i++)
+    {
+        uint32_t m = ctx->prevMetrics[i];
+        if(m < cost) cost = m;
+    }
+
+    return cost;
+}
+
+/**
+ * @brief Check if an add-compare-select kernel can run on this CPU.
+ *
+ * @param kernel Requested kernel. VITERBI_KERNEL_AUTO picks the fastest one available.
+ * @return viterbi_kernel_t Resolved kernel, VITERBI_KERNEL_AUTO if not supported.
+ */
+static viterbi_kernel_t resolve_kernel(viterbi_kernel_t kernel)
+{
+    uint32_t cpu = m17_cpu_features();
+
+    switch(kernel)
+    {
+        case VITERBI_KERNEL_AUTO:
+#ifdef M17_VITERBI_X86
+            if(cpu & M17_CPU_AVX2)
+                return VITERBI_KERNEL_AVX2;
+            if(cpu & M17_CPU_SSE2)
+                return VITERBI_KERNEL_SSE2;
+#endif
+#ifdef M17_VITERBI_NEON
+            if(cpu & M17_CPU_NEON)
+                return VITERBI_KERNEL_NEON;
+#endif
+            return VITERBI_KERNEL_SCALAR;
+
+        case VITERBI_KERNEL_SCALAR:
+            return kernel;
+
+#ifdef M17_VITERBI_X86
+        case VITERBI_KERNEL_SSE2:
+            return (cpu & M17_CPU_SSE2) ? kernel : VITERBI_KERNEL_AUTO;
+
+        case VITERBI_KERNEL_AVX2:
+            return (cpu & M17_CPU_AVX2) ? kernel : VITERBI_KERNEL_AUTO;
+#endif
+
+#ifdef M17_VITERBI_NEON
+        case VITERBI_KERNEL_NEON:
+            return (cpu & M17_CPU_NEON) ? kernel : VITERBI_KERNEL_AUTO;
+#endif
+
+        default:
+            return VITERBI_KERNEL_AUTO;
+    }
+}
+
+/**
+ * @brief Select the add-compare-select kernel used by a decoder context.
+ * All kernels give bit-exact results, they only differ in speed.
+ *
+ * @param ctx Pointer to a decoder context.
+ * @param kernel Kernel to use. VITERBI_KERNEL_AUTO picks the fastest one available.
+ * @return int8_t 0 on success, -1 if the kernel is not supported by the CPU.
+ */
+int8_t viterbi_set_kernel(viterbi_t* ctx, viterbi_kernel_t kernel)
+{
+    kernel = resolve_kernel(kernel);
+
+    if(kernel == VITERBI_KERNEL_AUTO)
+        return -1;
+
+    ctx->kernel = kernel;
+
+    return 0;
+}
+
+/**
+ * @brief Set decoding options of a context.
+ *
+ * @param ctx Pointer to a decoder context.
+ * @param opts Bitwise OR of M17_VITERBI_OPT_* flags, 0 for plain soft decoding.
+ * @param hard_max_err Highest number of hard bit errors accepted from the
+ *   hard decision decoder before falling back to soft decoding.
+ * @return int8_t 0 on success, -1 on unknown options.
+ */
+int8_t viterbi_set_opts(viterbi_t* ctx, uint8_t opts, uint16_t hard_max_err)
+{
+    if(opts & ~(M17_VITERBI_OPT_HARD | M17_VITERBI_OPT_SHORTCUT))
+        return -1;
+
+    ctx->opts = opts;
+    ctx->hard_max_err = hard_max_err;
+
+    return 0;
+}
+
+/**
+ * @brief Reset the decoder state.
+ *
+ * @param ctx Pointer to a decoder context.
+ */
+void viterbi_reset_ctx(viterbi_t* ctx)
+{
+    if(ctx->kernel == VITERBI_KERNEL_AUTO)
+        viterbi_set_kernel(ctx, VITERBI_KERNEL_AUTO);
+
+    memset(ctx->history, 0, sizeof(ctx->history));
+
+    ctx->prevMetrics = ctx->metricsA;
+    ctx->currMetrics = ctx->metricsB;
+
+    // initialize all states to a large cost
+    for (uint8_t i = 0; i < M17_CONVOL_STATES; i++)
+        ctx->prevMetrics[i] = 0x3FFFFFFF;
+
+    // only state 0 is valid at start
+    ctx->prevMetrics[0] = 0;
+
+    // currMetrics can be anything - will be overwritten
+}
+
+/**
+ * @brief Initialize a batch Viterbi decoder context.
+ *
+ * @param ctx Pointer to a batch decoder context.
+ */
+void viterbi_batch_init(viterbi_batch_t* ctx)
+{
+    memset(ctx, 0, sizeof(viterbi_batch_t));
+    ctx->kernel = resolve_kernel(VITERBI_KERNEL_AUTO);
+}
+
+/**
+ * @brief Select the add-compare-select kernel used by a batch decoder context.
+ *
+ * @param ctx Pointer to a batch decoder context.
+ * @param kernel Kernel to use. VITERBI_KERNEL_AUTO picks the fastest one available.
+ * @return int8_t 0 on success, -1 if the kernel is not supported by the CPU.
+ */
+int8_t viterbi_batch_set_kernel(viterbi_batch_t* ctx, viterbi_kernel_t kernel)
+{
+    kernel = resolve_kernel(kernel);
+
+    if(kernel == VITERBI_KERNEL_AUTO)
+        return -1;
+
+    ctx->kernel = kernel;
+
+    return 0;
+}
+
+/**
+ * @brief Scalar batch add-compare-select kernel - the reference implementation.
+ * Every lane is a separate frame, following exactly the same rules as `acs_scalar()`.
+ *
+ * @param prev Previous metrics, [state][lane].
+ * @param curr Current metrics, [state][lane].
+ * @param hist Decision words for this trellis step, one per lane.
+ * @param s0 Costs of the first symbol, one per lane.
+ * @param s1 Costs of the second symbol, one per lane.
+ * @param lanes Number of lanes to process.
+ */
+static void acs_batch_scalar(const uint32_t prev[][M17_VITERBI_BATCH_MAX], uint32_t curr[][M17_VITERBI_BATCH_MAX],
+    uint16_t* hist, const uint16_t* s0, const uint16_t* s1, uint8_t lanes)
+{
+    for(uint8_t l = 0; l < lanes; l++)
+    {
+        uint32_t a = s0[l], na = 0xFFFF - s0[l];
+        uint32_t b = s1[l], nb = 0xFFFF - s1[l];
+        const uint32_t bm[M17_CONVOL_STATES/2] = {a+b, a+nb, a+nb, a+b, na+b, na+nb, na+nb, na+b};
+        uint16_t dec = 0;
+
+        for(uint8_t i = 0; i < M17_CONVOL_STATES/2; i++)
+        {
+            uint32_t bm0 = bm[i];
+            uint32_t bm1 = 0x1FFFE - bm0;
+
+            uint32_t m0 = prev[i][l] + bm0;
+            uint32_t m1 = prev[i + M17_CONVOL_STATES/2][l] + bm1;
+            uint32_t m2 = prev[i][l] + bm1;
+            uint32_t m3 = prev[i + M17_CONVOL_STATES/2][l] + bm0;
+
+            dec |= (uint16_t)((m0 >= m1) << (2*i));
+            dec |= (uint16_t)((m2 >= m3) << (2*i+1));
+
+            curr[2*i][l]   = (m0 >= m1) ? m1 : m0;
+            curr[2*i+1][l] = (m2 >= m3) ? m3 : m2;
+        }
+
+        hist[l] = dec;
+    }
+}
+
+#ifdef M17_VITERBI_X86
+/**
+ * @brief SSE2 batch add-compare-select kernel. 4 frames per vector.
+ *
+ * @param prev Previous metrics, [state][lane].
+ * @param curr Current metrics, [state][lane].
+ * @param hist Decision words for this trellis step, one per lane.
+ * @param s0 Costs of the first symbol, one per lane.
+ * @param s1 Costs of the second symbol, one per lane.
+ * @param lanes Number of lanes to process, multiple of 4.
+ */
+__attribute__((target("sse2")))
+static void acs_batch_sse2(const uint32_t prev[][M17_VITERBI_BATCH_MAX], uint32_t curr[][M17_VITERBI_BATCH_MAX],
+    uint16_t* hist, const uint16_t* s0, const uint16_t* s1, uint8_t lanes)
+{
+    const __m128i bias = _mm_set1_epi32((int32_t)0x80000000);
+    const __m128i bm_max = _mm_set1_epi32(0x1FFFE);
+    const __m128i ffff = _mm_set1_epi32(0xFFFF);
+    const __m128i zero = _mm_setzero_si128();
+
+    for(uint8_t l = 0; l < lanes; l += 4)
+    {
+        __m128i a = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i*)&s0[l]), zero);
+        __m128i b = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i*)&s1[l]), zero);
+        __m128i na = _mm_sub_epi32(ffff, a);
+        __m128i nb = _mm_sub_epi32(ffff, b);
+        const __m128i bm_a = _mm_add_epi32(a, b);
+        const __m128i bm_b = _mm_add_epi32(a, nb);
+        const __m128i bm_c = _mm_add_epi32(na, b);
+        const __m128i bm_d = _mm_add_epi32(na, nb);
+        const __m128i bm[M17_CONVOL_STATES/2] = {bm_a, bm_b, bm_b, bm_a, bm_c, bm_d, bm_d, bm_c};
+        __m128i dec = zero;
+
+        for(uint8_t i = 0; i < M17_CONVOL_STATES/2; i++)
+        {
+            __m128i bm0 = bm[i];
+            __m128i bm1 = _mm_sub_epi32(bm_max, bm0);
+
+            __m128i p_lo = _mm_loadu_si128((const __m128i*)&prev[i][l]);
+            __m128i p_hi = _mm_loadu_si128((const __m128i*)&prev[i + M17_CONVOL_STATES/2][l]);
+
+            __m128i m0 = _mm_add_epi32(p_lo, bm0);
+            __m128i m1 = _mm_add_epi32(p_hi, bm1);
+            __m128i m2 = _mm_add_epi32(p_lo, bm1);
+            __m128i m3 = _mm_add_epi32(p_hi, bm0);
+
+            __m128i sel_e = _mm_cmpgt_epi32(_mm_xor_si128(m1, bias), _mm_xor_si128(m0, bias));
+            __m128i sel_o = _mm_cmpgt_epi32(_mm_xor_si128(m3, bias), _mm_xor_si128(m2, bias));
+
+            _mm_storeu_si128((__m128i*)&curr[2*i][l],   _mm_or_si128(_mm_and_si128(sel_e, m0), _mm_andnot_si128(sel_e, m1)));
+            _mm_storeu_si128((__m128i*)&curr[2*i+1][l], _mm_or_si128(_mm_and_si128(sel_o, m2), _mm_andnot_si128(sel_o, m3)));
+
+            dec = _mm_or_si128(dec, _mm_andnot_si128(sel_e, _mm_set1_epi32(1<<(2*i))));
+            dec = _mm_or_si128(dec, _mm_andnot_si128(sel_o, _mm_set1_epi32(1<<(2*i+1))));
+        }
+
+        //no unsigned saturating pack in SSE2 - shift to the signed range and back
+        dec = _mm_packs_epi32(_mm_sub_epi32(dec, _mm_set1_epi32(0x8000)), zero);
+        dec = _mm_xor_si128(dec, _mm_set1_epi16((int16_t)0x8000));
+        _mm_storel_epi64((__m128i*)&hist[l], dec);
+    }
+}
+
+/**
+ * @brief AVX2 batch add-compare-select kernel. 8 frames per vector.
+ *
+ * @param prev Previous metrics, [state][lane].
+ * @param curr Current metrics, [state][lane].
+ * @param hist Decision words for this trellis step, one per lane.
+ * @param s0 Costs of the first symbol, one per lane.
+ * @param s1 Costs of the second symbol, one per lane.
+ * @param lanes Number of lanes to process, multiple of 8.
+ */
+__attribute__((target("avx2")))
+static void acs_batch_avx2(const uint32_t prev[][M17_VITERBI_BATCH_MAX], uint32_t curr[][M17_VITERBI_BATCH_MAX],
+    uint16_t* hist, const uint16_t* s0, const uint16_t* s1, uint8_t lanes)
+{
+    const __m256i bm_max = _mm256_set1_epi32(0x1FFFE);
+    const __m256i ffff = _mm256_set1_epi32(0xFFFF);
+
+    for(uint8_t l = 0; l < lanes; l += 8)
+    {
+        __m256i a = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)&s0[l]));
+        __m256i b = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)&s1[l]));
+        __m256i na = _mm256_sub_epi32(ffff, a);
+        __m256i nb = _mm256_sub_epi32(ffff, b);
+        const __m256i bm_a = _mm256_add_epi32(a, b);
+        const __m256i bm_b = _mm256_add_epi32(a, nb);
+        const __m256i bm_c = _mm256_add_epi32(na, b);
+        const __m256i bm_d = _mm256_add_epi32(na, nb);
+        const __m256i bm[M17_CONVOL_STATES/2] = {bm_a, bm_b, bm_b, bm_a, bm_c, bm_d, bm_d, bm_c};
+        __m256i dec = _mm256_setzero_si256();
+
+        for(uint8_t i = 0; i < M17_CONVOL_STATES/2; i++)
+        {
+            __m256i bm0 = bm[i];
+            __m256i bm1 = _mm256_sub_epi32(bm_max, bm0);
+
+            __m256i p_lo = _mm256_loadu_si256((const __m256i*)&prev[i][l]);
+            __m256i p_hi = _mm256_loadu_si256((const __m256i*)&prev[i + M17_CONVOL_STATES/2][l]);
+
+            __m256i m1 = _mm256_add_epi32(p_hi, bm1);
+            __m256i m3 = _mm256_add_epi32(p_hi, bm0);
+            __m256i even = _mm256_min_epu32(_mm256_add_epi32(p_lo, bm0), m1);
+            __m256i odd  = _mm256_min_epu32(_mm256_add_epi32(p_lo, bm1), m3);
+
+            _mm256_storeu_si256((__m256i*)&curr[2*i][l], even);
+            _mm256_storeu_si256((__m256i*)&curr[2*i+1][l], odd);
+
+            dec = _mm256_or_si256(dec, _mm256_and_si256(_mm256_cmpeq_epi32(even, m1), _mm256_set1_epi32(1<<(2*i))));
+            dec = _mm256_or_si256(dec, _mm256_and_si256(_mm256_cmpeq_epi32(odd, m3), _mm256_set1_epi32(1<<(2*i+1))));
+        }
+
+        dec = _mm256_permute4x64_epi64(_mm256_packus_epi32(dec, _mm256_setzero_si256()), 0x08);
+        _mm_storeu_si128((__m128i*)&hist[l], _mm256_castsi256_si128(dec));
+    }
+}
+#endif
+
+#ifdef M17_VITERBI_NEON
+/**
+ * @brief NEON batch add-compare-select kernel. 4 frames per vector.
+ *
+ * @param prev Previous metrics, [state][lane].
+ * @param curr Current metrics, [state][lane].
+ * @param hist Decision words for this trellis step, one per lane.
+ * @param s0 Costs of the first symbol, one per lane.
+ * @param s1 Costs of the second symbol, one per lane.
+ * @param lanes Number of lanes to process, multiple of 4.
+ */
+static void acs_batch_neon(const uint32_t prev[][M17_VITERBI_BATCH_MAX], uint32_t curr[][M17_VITERBI_BATCH_MAX],
+    uint16_t* hist, const uint16_t* s0, const uint16_t* s1, uint8_t lanes)
+{
+    const uint32x4_t bm_max = vdupq_n_u32(0x1FFFE);
+    const uint32x4_t ffff = vdupq_n_u32(0xFFFF);
+
+    for(uint8_t l = 0; l < lanes; l += 4)
+    {
+        uint32x4_t a = vmovl_u16(vld1_u16(&s0[l]));
+        uint32x4_t b = vmovl_u16(vld1_u16(&s1[l]));
+        uint32x4_t na = vsubq_u32(ffff, a);
+        uint32x4_t nb = vsubq_u32(ffff, b);
+        const uint32x4_t bm_a = vaddq_u32(a, b);
+        const uint32x4_t bm_b = vaddq_u32(a, nb);
+        const uint32x4_t bm_c = vaddq_u32(na, b);
+        const uint32x4_t bm_d = vaddq_u32(na, nb);
+        const uint32x4_t bm[M17_CONVOL_STATES/2] = {bm_a, bm_b, bm_b, bm_a, bm_c, bm_d, bm_d, bm_c};
+        uint32x4_t dec = vdupq_n_u32(0);
+
+        for(uint8_t i = 0; i < M17_CONVOL_STATES/2; i++)
+        {
+            uint32x4_t bm0 = bm[i];
+            uint32x4_t bm1 = vsubq_u32(bm_max, bm0);
+
+            uint32x4_t p_lo = vld1q_u32(&prev[i][l]);
+            uint32x4_t p_hi = vld1q_u32(&prev[i + M17_CONVOL_STATES/2][l]);
+
+            uint32x4_t m0 = vaddq_u32(p_lo, bm0);
+            uint32x4_t m1 = vaddq_u32(p_hi, bm1);
+            uint32x4_t m2 = vaddq_u32(p_lo, bm1);
+            uint32x4_t m3 = vaddq_u32(p_hi, bm0);
+
+            vst1q_u32(&curr[2*i][l], vminq_u32(m0, m1));
+            vst1q_u32(&curr[2*i+1][l], vminq_u32(m2, m3));
+
+            dec = vorrq_u32(dec, vandq_u32(vcgeq_u32(m0, m1), vdupq_n_u32(1<<(2*i))));
+            dec = vorrq_u32(dec, vandq_u32(vcgeq_u32(m2, m3), vdupq_n_u32(1<<(2*i+1))));
+        }
+
+        vst1_u16(&hist[l], vmovn_u32(dec));
+    }
+}
+#endif
+
+/**
+ * @brief Decode a batch of punctured frames at once, one frame per SIMD lane.
+ * All frames have to be of the same type - they share the depuncturing
+ * and traceback schedule. Results are bit-exact with `viterbi_decode_punctured_ctx()`.
+ *
+ * @param ctx Pointer to a batch decoder context.
+ * @param out Array of n pointers to destination arrays for decoded data.
+ * @param cost Array of n Viterbi metrics, one per frame.
+ * @param in Array of n pointers to input soft bits.
+ * @param punct Puncturing matrix.
+ * @param in_len Input data length (per frame).
+ * @param p_len Puncturing matrix length (entries).
+ * @param n Number of frames, 1 to M17_VITERBI_BATCH_MAX.
+ * @return int8_t 0 on success, -1 on invalid batch size or input length.
+ */
+int8_t viterbi_decode_punctured_batch(viterbi_batch_t* ctx, uint8_t* const out[], uint32_t cost[],
+    const uint16_t* const in[], const uint8_t* punct, uint16_t in_len, uint16_t p_len, uint8_t n)
+{
+    if(n == 0 || n > M17_VITERBI_BATCH_MAX || in_len > M17_VITERBI_HIST_LEN_2)
+        return -1;
+
+    uint16_t s0[M17_VITERBI_BATCH_MAX] = {0};   //per-lane symbol costs
+    uint16_t s1[M17_VITERBI_BATCH_MAX] = {0};
+    uint8_t lanes = (n + 7) & ~7;               //padded lanes are fed zero-cost input
+    uint8_t cur = 0;                            //current metrics buffer
+    uint8_t p = 0;                              //puncturer matrix entry
+    uint16_t i = 0;                             //bits read from the input message
+    uint16_t u = 0;                             //bits count - unpunctured message
+    size_t pos = 0;                             //trellis step
+
+    if(lanes > M17_VITERBI_BATCH_MAX)
+        lanes = M17_VITERBI_BATCH_MAX;
+
+    //only state 0 is valid at start
+    for(uint8_t s = 0; s < M17_CONVOL_STATES; s++)
+        for(uint8_t l = 0; l < lanes; l++)
+            ctx->metrics[cur][s][l] = (s == 0) ? 0 : 0x3FFFFFFF;
+
+    while(i < in_len)
+    {
+        if(pos >= M17_VITERBI_HIST_LEN)
+            return -1;
+
+        //depuncture both symbols of the step, same schedule for every lane
+        for(uint8_t k = 0; k < 2; k++)
+        {
+            uint16_t* s = k ? s1 : s0;
+
+            if(punct[p] && i < in_len)
+            {
+                for(uint8_t l = 0; l < n; l++)
+                    s[l] = in[l][i];
+                i++;
+            }
+            else
+            {
+                for(uint8_t l = 0; l < n; l++)
+                    s[l] = 0x7FFF;
+            }
+
+            u++;
+            p++;
+            p %= p_len;
+        }
+
+        switch(ctx->kernel)
+        {
+#ifdef M17_VITERBI_X86
+            case VITERBI_KERNEL_SSE2:
+                acs_batch_sse2((const uint32_t (*)[M17_VITERBI_BATCH_MAX])ctx->metrics[cur], ctx->metrics[cur^1], ctx->history[pos], s0, s1, lanes);
+            break;
+
+            case VITERBI_KERNEL_AVX2:
+                acs_batch_avx2((const uint32_t (*)[M17_VITERBI_BATCH_MAX])ctx->metrics[cur], ctx->metrics[cur^1], ctx->history[pos], s0, s1, lanes);
+            break;
+#endif
+
+#ifdef M17_VITERBI_NEON
+            case VITERBI_KERNEL_NEON:
+                acs_batch_neon((const uint32_t (*)[M17_VITERBI_BATCH_MAX])ctx->metrics[cur], ctx->metrics[cur^1], ctx->history[pos], s0, s1, lanes);
+            break;
+#endif
+
+            default:
+                acs_batch_scalar((const uint32_t (*)[M17_VITERBI_BATCH_MAX])ctx->metrics[cur], ctx->metrics[cur^1], ctx->history[pos], s0, s1, n);
+            break;
+        }
+
+        cur ^= 1;
+        pos++;
+    }
+
+    //chainback, separately for every frame
+    for(uint8_t l = 0; l < n; l++)
+    {
+        uint8_t state = 0;
+        size_t bitPos = pos+4;
+
+        memset(out[l], 0, (bitPos+7)/8);
+
+        for(size_t k = pos; k > 0; k--)
+        {
+            bitPos--;
+            uint16_t bit = ctx->history[k-1][l]&((1<<(state>>4)));
+            state >>= 1;
+            if(bit)
+            {
+                state |= 0x80;
+                out[l][bitPos/8]|=1<<(7-(bitPos%8));
+            }
+        }
+
+        uint32_t c = ctx->metrics[cur][0][l];
+        for(uint8_t s = 1; s < M17_CONVOL_STATES; s++)
+        {
+            if(ctx->metrics[cur][s][l] < c)
+                c = ctx->metrics[cur][s][l];
+        }
+
+        cost[l] = c - (u-in_len)*0x7FFF;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Initialize a streaming Viterbi decoder.
+ *
+ * @param ctx Pointer to a streaming decoder context.
+ * @param depth Traceback depth in trellis steps, 1 to M17_VITERBI_STREAM_DEPTH_MAX.
+ *   Anything above 5-10 times the constraint length gives no further gain.
+ * @param punct Puncturing matrix of the input, NULL if the input is not punctured.
+ * @param p_len Puncturing matrix length (entries), with at least one non-zero entry.
+ * @return int8_t 0 on success, -1 on invalid parameters.
+ */
+int8_t viterbi_stream_init(viterbi_stream_t* ctx, uint16_t depth, const uint8_t* punct, uint16_t p_len)
+{
+    if(depth == 0 || depth > M17_VITERBI_STREAM_DEPTH_MAX || (punct != NULL && p_len == 0))
+        return -1;
+
+    //a matrix without any kept entries never consumes input
+    if(punct != NULL)
+    {
+        uint16_t kept = 0;
+
+        for(uint16_t i = 0; i < p_len; i++)
+            kept += (punct[i] != 0);
+
+        if(kept == 0)
+            return -1;
+    }
+
+    memset(ctx, 0, sizeof(viterbi_stream_t));
+    viterbi_init(&ctx->vit);
+
+    ctx->punct = punct;
+    ctx->p_len = p_len;
+    ctx->depth = depth;
+
+    return 0;
+}
+
+/**
+ * @brief Trace the survivor path back through the circular history
+ * and emit the decisions of the oldest trellis steps.
+ *
+ * @param ctx Pointer to a streaming decoder context.
+ * @param out Destination array for unpacked bits.
+ * @param state Trellis state to start from.
+ * @param emit Number of trellis steps to emit.
+ */
+static void stream_traceback(viterbi_stream_t* ctx, uint8_t* out, uint8_t state, uint16_t emit)
+{
+    uint16_t pos = ctx->head;
+
+    for(uint16_t i = ctx->fill; i > 0; i--)
+    {
+        pos = (pos == 0) ? 2*ctx->depth-1 : pos-1;
+
+        //the input bit of a step is the LSB of the state it leads to
+        if(i <= emit)
+            out[i-1] = state & 1;
+
+        state = (state >> 1) | (((ctx->vit.history[pos] >> state) & 1) << 3);
+    }
+
+    ctx->fill -= emit;
+}
+
+/**
+ * @brief Run one trellis step of the streaming decoder.
+ * Renormalizes the metrics and emits `depth` bits once the history is full.
+ *
+ * @param ctx Pointer to a streaming decoder context.
+ * @param out Destination array for unpacked bits.
+ * @param s0 Cost of the first symbol.
+ * @param s1 Cost of the second symbol.
+ * @return uint16_t Number of bits emitted.
+ */
+static uint16_t stream_step(viterbi_stream_t* ctx, uint8_t* out, uint16_t s0, uint16_t s1)
+{
+    viterbi_decode_bit_ctx(&ctx->vit, s0, s1, ctx->head);
+
+    ctx->head = (ctx->head+1) % (2*ctx->depth);
+    ctx->fill++;
+
+    if(ctx->fill < 2*ctx->depth)
+        return 0;
+
+    //subtract the best metric, so that long streams never overflow
+    uint32_t *m = ctx->vit.prevMetrics;
+    uint8_t best = 0;
+
+    for(uint8_t i = 1; i < M17_CONVOL_STATES; i++)
+    {
+        if(m[i] < m[best]) best = i;
+    }
+
+    uint32_t min = m[best];
+    for(uint8_t i = 0; i < M17_CONVOL_STATES; i++)
+        m[i] -= min;
+    ctx->norm += min;
+
+    stream_traceback(ctx, out, best, ctx->depth);
+
+    return ctx->depth;
+}
+
+/**
+ * @brief Feed soft bits to the streaming decoder.
+ * Input can be split into chunks of any length, including odd ones.
+ *
+ * @param ctx Pointer to a streaming decoder context.
+ * @param out Destination array for unpacked decoded bits, room for at least
+ *   (depunctured len)/2 + depth entries is required.
+ * @param in Input soft bits, punctured if the decoder was initialized with a puncturing matrix.
+ * @param len Input length.
+ * @return uint16_t Number of bits written to out.
+ */
+uint16_t viterbi_stream_push(viterbi_stream_t* ctx, uint8_t* out, const uint16_t* in, uint16_t len)
+{
+    uint16_t n = 0;
+    uint16_t i = 0;
+
+    while(i < len)
+    {
+        uint16_t s;
+
+        if(ctx->punct == NULL || ctx->punct[ctx->p])
+        {
+            s = in[i];
+            i++;
+        }
+        else
+        {
+            s = 0x7FFF;
+            ctx->erasures++;
+        }
+
+        if(ctx->punct != NULL && ++ctx->p == ctx->p_len)
+            ctx->p = 0;
+
+        if(!ctx->has_pend)
+        {
+            ctx->pend = s;
+            ctx->has_pend = 1;
+        }
+        else
+        {
+            ctx->has_pend = 0;
+            n += stream_step(ctx, &out[n], ctx->pend, s);
+        }
+    }
+
+    return n;
+}
+
+/**
+ * @brief Finish the stream: emit all remaining bits and reset the decoder.
+ * The encoder is assumed to be flushed with K-1 zero bits, so the traceback
+ * starts at state 0. These flushing bits are the last ones emitted.
+ *
+ * @param ctx Pointer to a streaming decoder context.
+ * @param out Destination array for unpacked decoded bits, room for at least
+ *   2*depth entries is required.
+ * @param cost Total Viterbi metric of the stream, corrected for erasures. Can be NULL.
+ * @return uint16_t Number of bits written to out.
+ */
+uint16_t viterbi_stream_flush(viterbi_stream_t* ctx, uint8_t* out, uint32_t* cost)
+{
+    uint16_t n = 0;
+
+    //a trailing odd bit is padded with an erasure
+    if(ctx->has_pend)
+    {
+        ctx->has_pend = 0;
+        ctx->erasures++;
+        n = stream_step(ctx, out, ctx->pend, 0x7FFF);
+    }
+
+    if(cost != NULL)
+    {
+        uint32_t min = ctx->vit.prevMetrics[0];
+
+        for(uint8_t i = 1; i < M17_CONVOL_STATES; i++)
+        {
+            if(ctx->vit.prevMetrics[i] < min) min = ctx->vit.prevMetrics[i];
+        }
+
+        uint64_t c = ctx->norm + min - (uint64_t)ctx->erasures*0x7FFF;
+        *cost = (c > UINT32_MAX) ? UINT32_MAX : c;
+    }
+
+    uint16_t rem = ctx->fill;
+    stream_traceback(ctx, &out[n], 0, rem);
+    n += rem;
+
+    //ready for the next stream
+    viterbi_reset_ctx(&ctx->vit);
+    ctx->p = 0;
+    ctx->head = 0;
+    ctx->erasures = 0;
+    ctx->norm = 0;
+
+    return n;
+}
+
+/**
+ * @brief Initialize a soft-output Viterbi decoder context.
+ *
+ * @param ctx Pointer to a SOVA decoder context.
+ */
+void viterbi_sova_init(viterbi_sova_t* ctx)
+{
+    memset(ctx, 0, sizeof(viterbi_sova_t));
+    viterbi_init(&ctx->vit);
+}
+
+/**
+ * @brief Add-compare-select step that also stores the path metric differences.
+ * Decisions are the same as those of the other kernels.
+ *
+ * @param ctx Pointer to a SOVA decoder context.
+ * @param s0 Cost of the first symbol.
+ * @param s1 Cost of the second symbol.
+ * @param pos Bit position in history.
+ */
+static void acs_sova(viterbi_sova_t* ctx, uint16_t s0, uint16_t s1, size_t pos)
+{
+    static const uint16_t COST_TABLE_0[] = {0, 0, 0, 0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF};
+    static const uint16_t COST_TABLE_1[] = {0, 0xFFFF, 0xFFFF, 0, 0, 0xFFFF, 0xFFFF, 0};
+
+    viterbi_t *vit = &ctx->vit;
+    uint16_t dec = 0;
+
+    for(uint8_t i = 0; i < M17_CONVOL_STATES/2; i++)
+    {
+        uint16_t e0 = COST_TABLE_0[i];
+        uint16_t e1 = COST_TABLE_1[i];
+
+        uint32_t bm0 = q_abs_diff(e0, s0) + q_abs_diff(e1, s1);
+        uint32_t bm1 = 0x1FFFE - bm0;
+
+        uint32_t m0 = vit->prevMetrics[i] + bm0;
+        uint32_t m1 = vit->prevMetrics[i + M17_CONVOL_STATES/2] + bm1;
+        uint32_t m2 = vit->prevMetrics[i] + bm1;
+        uint32_t m3 = vit->prevMetrics[i + M17_CONVOL_STATES/2] + bm0;
+
+        uint32_t d_e = (m0 >= m1) ? m0 - m1 : m1 - m0;
+        uint32_t d_o = (m2 >= m3) ? m2 - m3 : m3 - m2;
+
+        vit->currMetrics[2*i]   = (m0 >= m1) ? m1 : m0;
+        vit->currMetrics[2*i+1] = (m2 >= m3) ? m3 : m2;
+        dec |= ((m0 >= m1) << (2*i)) | ((m2 >= m3) << (2*i+1));
+
+        ctx->delta[pos][2*i]   = (d_e > 0xFFFF) ? 0xFFFF : d_e;
+        ctx->delta[pos][2*i+1] = (d_o > 0xFFFF) ? 0xFFFF : d_o;
+    }
+
+    vit->history[pos] = dec;
+
+    uint32_t *tmp = vit->prevMetrics;
+    vit->prevMetrics = vit->currMetrics;
+    vit->currMetrics = tmp;
+}
+
+/**
+ * @brief Decode punctured convolutionally encoded data with soft outputs.
+ * Decoded bits and the metric are identical to those of `viterbi_decode_punctured_ctx()`.
+ * The reliability of a bit is the smallest path metric difference among
+ * the competing paths that would have flipped it (Hagenauer's SOVA).
+ *
+ * @param ctx Pointer to a SOVA decoder context.
+ * @param out Destination array where decoded data is written.
+ * @param rel Reliabilities of the decoded bits, rel[0] belongs to the first bit
+ *   of out[1], as out[0] only holds the flushing bits. Saturated at 0xFFFF.
+ * @param in Input data.
+ * @param punct Puncturing matrix.
+ * @param in_len Input data length.
+ * @param p_len Puncturing matrix length (entries).
+ * @return uint32_t Viterbi metric, UINT32_MAX on invalid input length.
+ */
+uint32_t viterbi_decode_punctured_sova(viterbi_sova_t* ctx, uint8_t* out, uint16_t* rel, const uint16_t* in, const uint8_t* punct, uint16_t in_len, uint16_t p_len)
+{
+    viterbi_t *vit = &ctx->vit;
+
+    if(in_len > M17_VITERBI_HIST_LEN_2)
+		return UINT32_MAX; //emit a large value
+
+    viterbi_reset_ctx(vit);
+
+	uint8_t p=0;		                    //puncturer matrix entry
+	uint16_t u=0;		                    //bits count - unpunctured message
+    uint16_t i=0;                           //bits read from the input message
+    size_t pos=0;                           //decoder steps
+
+	while(i<in_len)
+	{
+        if(pos == M17_VITERBI_HIST_LEN)
+            return UINT32_MAX; //unpunctured message does not fit in the history
+
+        uint16_t s[2];
+
+        for(uint8_t k=0; k<2; k++)
+        {
+            //a trailing odd bit is padded with an erasure
+            if(i<in_len && punct[p])
+                s[k]=in[i++];
+            else
+                s[k]=0x7FFF;
+
+            u++;
+            if(++p == p_len)
+                p = 0;
+        }
+
+        acs_sova(ctx, s[0], s[1], pos);
+        pos++;
+	}
+
+    uint32_t cost = viterbi_chainback_ctx(vit, out, pos, u/2) - (u-in_len)*0x7FFF;
+
+    //states of the best path, state[t] is the one after step t-1
+    ctx->state[pos] = 0;
+    for(size_t t = pos; t > 0; t--)
+    {
+        uint8_t s = ctx->state[t];
+        ctx->state[t-1] = (s >> 1) | (((vit->history[t-1] >> s) & 1) << 3);
+    }
+
+    //the input bit of step t is bit 0 of state[t+1], and it lands in out at bit t+8
+    uint16_t data_len = (pos > 4) ? pos-4 : 0;
+
+    for(uint16_t t = 0; t < data_len; t++)
+        rel[t] = 0xFFFF;
+
+    for(size_t t = pos; t > 0; t--)
+    {
+        uint8_t s = ctx->state[t];
+        uint16_t d = ctx->delta[t-1][s];
+
+        //follow the discarded path until it merges with the best one
+        uint8_t c = (s >> 1) | ((((vit->history[t-1] >> s) & 1) ^ 1) << 3);
+
+        for(size_t k = t-1; k > 0 && c != ctx->state[k]; k--)
+        {
+            if(((c ^ ctx->state[k]) & 1) && k-1 < data_len && d < rel[k-1])
+                rel[k-1] = d;
+
+            c = (c >> 1) | (((vit->history[k-1] >> c) & 1) << 3);
+        }
+    }
+
+    return cost;
+}
+
+/**
+ * @brief Decode unpunctured convolutionally encoded data.
+ * Uses the library's shared decoder context - not reentrant.
+ *
+ * @param out Destination array where decoded data is written.
+ * @param in Input data.
+ * @param len Input length in bits.
+ * @return Number of bit errors corrected.
+ */
+uint32_t viterbi_decode(uint8_t* out, const uint16_t* in, uint16_t len)
+{
+    return viterbi_decode_ctx(&viterbi_ctx, out, in, len);
+}
+
+/**
+ * @brief Decode punctured convolutionally encoded data.
+ * Uses the library's shared decoder context - not reentrant.
+ *
+ * @param out Destination array where decoded data is written.
+ * @param in Input data.
+ * @param punct Puncturing matrix.
+ * @param in_len Input data length.
+ * @param p_len Puncturing matrix length (entries).
+ * @return Number of bit errors corrected.
+ */
+uint32_t viterbi_decode_punctured(uint8_t* out, const uint16_t* in, const uint8_t* punct, uint16_t in_len, uint16_t p_len)
+{
+    return viterbi_decode_punctured_ctx(&viterbi_ctx, out, in, punct, in_len, p_len);
+}
+
+/**
+ * @brief Decode one bit and update trellis.
+ * Uses the library's shared decoder context - not reentrant.
+ *
+ * @param s0 Cost of the first symbol.
+ * @param s1 Cost of the second symbol.
+ * @param pos Bit position in history.
+ */
+void viterbi_decode_bit(uint16_t s0, uint16_t s1, size_t pos)
+{
+    viterbi_decode_bit_ctx(&viterbi_ctx, s0, s1, pos);
+}
+
+/**
+ * @brief History chainback to obtain final byte array.
+ * Uses the library's shared decoder context - not reentrant.
+ *
+ * @param out Destination byte array for decoded data.
+ * @param pos Starting position for the chainback.
+ * @param len Length of the output in bits (minus K-1=4).
+ * @return Minimum Viterbi cost at the end of the decode sequence.
+ */
+uint32_t viterbi_chainback(uint8_t* out, size_t pos, uint16_t len)
+{
+    return viterbi_chainback_ctx(&viterbi_ctx, out, pos, len);
+}
+
+/**
+ * @brief Reset the decoder state. No args.
+ * Uses the library's shared decoder context - not reentrant.
+ */
+void viterbi_reset(void)
+{
+    viterbi_reset_ctx(&viterbi_ctx);
 }
@@ -4,6 +4,7 @@
 // This file contains:
 // - convolutional encoders
 //   for the LSF, stream, packet, and BERT frames
+// - table-driven encoders with packed output
 //
 // Wojciech Kaczmarski, SP5WWP
 // M17 Foundation, 18 January 2026
@@ -287,7 +288,8 @@ void conv_encode_bert_frame(uint8_t out[SYM_PER_PLD*2], const uint8_t in[25])
 		p++;
 		p%=pp_len;
 
-		if(puncture_pattern_2[p])
+		//402 type-2 bits puncture to 369, the last one does not fit
+		if(puncture_pattern_2[p] && pb<SYM_PER_PLD*2)
 		{
 			out[pb]=G2;
 			pb++;
@@ -297,3 +299,234 @@ void conv_encode_bert_frame(uint8_t out[SYM_PER_PLD*2], const uint8_t in[25])
 		p%=pp_len;
 	}
 }
+
+/**
+ * @brief Encoder outputs caused by the encoder state alone, 8 steps with zero input.
+ * Output bits are G1, G2 pairs, MSB first. Index: last 4 input bits, newest at bit 0.
+ */
+static const uint16_t conv_state_table[16]=
+{
+	0x0000, 0x5B00, 0x6C00, 0x3700, 0xB000, 0xEB00, 0xDC00, 0x8700,
+	0xC000, 0x9B00, 0xAC00, 0xF700, 0x7000, 0x2B00, 0x1C00, 0x4700
+};
+
+/**
+ * @brief Encoder outputs caused by an input byte alone, starting from state 0.
+ * The code is linear, so the output for any state and byte is
+ * conv_state_table[state] ^ conv_input_table[byte].
+ */
+static const uint16_t conv_input_table[256]=
+{
+	0x0000, 0x0003, 0x000D, 0x000E, 0x0035, 0x0036, 0x0038, 0x003B,
+	0x00D6, 0x00D5, 0x00DB, 0x00D8, 0x00E3, 0x00E0, 0x00EE, 0x00ED,
+	0x035B, 0x0358, 0x0356, 0x0355, 0x036E, 0x036D, 0x0363, 0x0360,
+	0x038D, 0x038E, 0x0380, 0x0383, 0x03B8, 0x03BB, 0x03B5, 0x03B6,
+	0x0D6C, 0x0D6F, 0x0D61, 0x0D62, 0x0D59, 0x0D5A, 0x0D54, 0x0D57,
+	0x0DBA, 0x0DB9, 0x0DB7, 0x0DB4, 0x0D8F, 0x0D8C, 0x0D82, 0x0D81,
+	0x0E37, 0x0E34, 0x0E3A, 0x0E39, 0x0E02, 0x0E01, 0x0E0F, 0x0E0C,
+	0x0EE1, 0x0EE2, 0x0EEC, 0x0EEF, 0x0ED4, 0x0ED7, 0x0ED9, 0x0EDA,
+	0x35B0, 0x35B3, 0x35BD, 0x35BE, 0x3585, 0x3586, 0x3588, 0x358B,
+	0x3566, 0x3565, 0x356B, 0x3568, 0x3553, 0x3550, 0x355E, 0x355D,
+	0x36EB, 0x36E8, 0x36E6, 0x36E5, 0x36DE, 0x36DD, 0x36D3, 0x36D0,
+	0x363D, 0x363E, 0x3630, 0x3633, 0x3608, 0x360B, 0x3605, 0x3606,
+	0x38DC, 0x38DF, 0x38D1, 0x38D2, 0x38E9, 0x38EA, 0x38E4, 0x38E7,
+	0x380A, 0x3809, 0x3807, 0x3804, 0x383F, 0x383C, 0x3832, 0x3831,
+	0x3B87, 0x3B84, 0x3B8A, 0x3B89, 0x3BB2, 0x3BB1, 0x3BBF, 0x3BBC,
+	0x3B51, 0x3B52, 0x3B5C, 0x3B5F, 0x3B64, 0x3B67, 0x3B69, 0x3B6A,
+	0xD6C0, 0xD6C3, 0xD6CD, 0xD6CE, 0xD6F5, 0xD6F6, 0xD6F8, 0xD6FB,
+	0xD616, 0xD615, 0xD61B, 0xD618, 0xD623, 0xD620, 0xD62E, 0xD62D,
+	0xD59B, 0xD598, 0xD596, 0xD595, 0xD5AE, 0xD5AD, 0xD5A3, 0xD5A0,
+	0xD54D, 0xD54E, 0xD540, 0xD543, 0xD578, 0xD57B, 0xD575, 0xD576,
+	0xDBAC, 0xDBAF, 0xDBA1, 0xDBA2, 0xDB99, 0xDB9A, 0xDB94, 0xDB97,
+	0xDB7A, 0xDB79, 0xDB77, 0xDB74, 0xDB4F, 0xDB4C, 0xDB42, 0xDB41,
+	0xD8F7, 0xD8F4, 0xD8FA, 0xD8F9, 0xD8C2, 0xD8C1, 0xD8CF, 0xD8CC,
+	0xD821, 0xD822, 0xD82C, 0xD82F, 0xD814, 0xD817, 0xD819, 0xD81A,
+	0xE370, 0xE373, 0xE37D, 0xE37E, 0xE345, 0xE346, 0xE348, 0xE34B,
+	0xE3A6, 0xE3A5, 0xE3AB, 0xE3A8, 0xE393, 0xE390, 0xE39E, 0xE39D,
+	0xE02B, 0xE028, 0xE026, 0xE025, 0xE01E, 0xE01D, 0xE013, 0xE010,
+	0xE0FD, 0xE0FE, 0xE0F0, 0xE0F3, 0xE0C8, 0xE0CB, 0xE0C5, 0xE0C6,
+	0xEE1C, 0xEE1F, 0xEE11, 0xEE12, 0xEE29, 0xEE2A, 0xEE24, 0xEE27,
+	0xEECA, 0xEEC9, 0xEEC7, 0xEEC4, 0xEEFF, 0xEEFC, 0xEEF2, 0xEEF1,
+	0xED47, 0xED44, 0xED4A, 0xED49, 0xED72, 0xED71, 0xED7F, 0xED7C,
+	0xED91, 0xED92, 0xED9C, 0xED9F, 0xEDA4, 0xEDA7, 0xEDA9, 0xEDAA
+};
+
+/**
+ * @brief Table-driven convolutional encoder, 8 input bits per step.
+ * The encoder is flushed with 4 zero bits at the end.
+ *
+ * @param out Output - packed type-2 bits, 16 per input byte, G1 first, MSB first.
+ *   (len+4+7)/8 words are written.
+ * @param in Input - packed array of uint8_t, MSB first.
+ * @param len Input length in bits.
+ */
+void conv_encode_packed(uint16_t* out, const uint8_t* in, uint16_t len)
+{
+	uint8_t state=0;		//last 4 input bits, newest at bit 0
+	uint16_t n=(len+4+7)/8;	//number of steps, flushing included
+
+	for(uint16_t i=0; i<n; i++)
+	{
+		uint8_t b=0;
+
+		if(i<len/8)
+			b=in[i];
+		else if(i==len/8 && len%8)
+			b=in[i]&(0xFF<<(8-len%8)); //partial byte, the rest is flushing
+
+		out[i]=conv_state_table[state]^conv_input_table[b];
+		state=b&0x0F;
+	}
+}
+
+/**
+ * @brief Puncture packed type-2 bits into packed type-3 bits.
+ *
+ * @param out Output - packed type-3 bits, MSB first.
+ * @param in Input - packed type-2 bits, as produced by conv_encode_packed().
+ * @param len Number of type-2 bits.
+ * @param punct Puncturing matrix.
+ * @param p_len Puncturing matrix length (entries).
+ * @param max_len Maximum number of type-3 bits, the rest is dropped.
+ * @return uint16_t Number of type-3 bits written, 0 for an empty or too fragmented matrix.
+ */
+uint16_t conv_puncture_packed(uint8_t* out, const uint16_t* in, uint16_t len, const uint8_t* punct, uint16_t p_len, uint16_t max_len)
+{
+	uint8_t runs[64][2];		//lengths of the runs of kept and punctured bits in the matrix
+	uint8_t n_runs=0;
+	uint16_t words=(len+15)/16;	//input length in words
+	uint16_t pb=0;				//pushed punctured bits
+	uint16_t a=0;				//type-2 bits consumed
+	uint64_t acc=0;				//bits not yet written out
+	uint8_t nacc=0;
+
+	if(p_len==0)
+		return 0; //no matrix to cycle through
+
+	for(uint16_t p=0; p<p_len; n_runs++)
+	{
+		if(n_runs==sizeof(runs)/sizeof(runs[0]))
+			return 0; //matrix too fragmented
+
+		runs[n_runs][0]=0;
+		runs[n_runs][1]=0;
+		while(p<p_len && punct[p] && runs[n_runs][0]<255)
+		{
+			runs[n_runs][0]++;
+			p++;
+		}
+		while(p<p_len && !punct[p] && runs[n_runs][1]<255)
+		{
+			runs[n_runs][1]++;
+			p++;
+		}
+	}
+
+	memset(out, 0, (max_len+7)/8);
+
+	for(uint8_t r=0; a<len && pb<max_len; r=(r+1==n_runs) ? 0 : r+1)
+	{
+		uint16_t run=runs[r][0];
+
+		if(run>len-a)
+			run=len-a;
+		if(run>max_len-pb)
+			run=max_len-pb;
+
+		while(run)
+		{
+			uint8_t n=(run>16) ? 16 : run;
+			uint32_t win=((uint32_t)in[a/16]<<16) | ((a/16+1<words) ? in[a/16+1] : 0);
+
+			acc=(acc<<n) | ((win>>(32-a%16-n)) & ((1UL<<n)-1));
+			nacc+=n;
+			pb+=n;
+			a+=n;
+			run-=n;
+
+			while(nacc>=8)
+			{
+				nacc-=8;
+				out[(pb-nacc)/8-1]=acc>>nacc;
+			}
+		}
+
+		a+=runs[r][1];
+	}
+
+	//last partial byte
+	if(nacc)
+		out[pb/8]=acc<<(8-nacc);
+
+	return pb;
+}
+
+/**
+ * @brief Encode M17 stream frame into packed bits, using the table-driven encoder.
+ *
+ * @param out Output - packed array of uint8_t, 272 type-3 bits.
+ * @param in Input - packed array of uint8_t, 128 bits of payload.
+ * @param fn Input - 16-bit frame number.
+ */
+void conv_encode_stream_frame_packed(uint8_t out[34], const uint8_t in[16], const uint16_t fn)
+{
+	uint8_t ud[2+16];
+	uint16_t enc[(144+4+7)/8];
+
+	ud[0]=fn>>8;
+	ud[1]=fn&0xFF;
+	memcpy(&ud[2], in, 16);
+
+	conv_encode_packed(enc, ud, 144);
+	conv_puncture_packed(out, enc, 2*(144+4), puncture_pattern_2, sizeof(puncture_pattern_2), 272);
+}
+
+/**
+ * @brief Encode M17 packet frame into packed bits, using the table-driven encoder.
+ *
+ * @param out Output - packed array of uint8_t, 368 type-3 bits.
+ * @param in Input - packed array of uint8_t, 206 type-1 bits
+ *   (200 bits of data, 1 bit End of Frame indicator, 5 bits frame/byte counter).
+ */
+void conv_encode_packet_frame_packed(uint8_t out[SYM_PER_PLD*2/8], const uint8_t in[26])
+{
+	uint16_t enc[(206+4+7)/8];
+
+	conv_encode_packed(enc, in, 206);
+	conv_puncture_packed(out, enc, 2*(206+4), puncture_pattern_3, sizeof(puncture_pattern_3), SYM_PER_PLD*2);
+}
+
+/**
+ * @brief Encode Link Setup Frame into packed bits, using the table-driven encoder.
+ *
+ * @param out Output - packed array of uint8_t, 368 type-3 bits.
+ * @param in Input - pointer to a struct holding the Link Setup Data and its 16-bit CRC.
+ */
+void conv_encode_LSF_packed(uint8_t out[SYM_PER_PLD*2/8], const lsf_t* in)
+{
+	uint8_t ud[30];
+	uint16_t enc[(240+4+7)/8];
+
+	memcpy(&ud[0], in->dst, 6);
+	memcpy(&ud[6], in->src, 6);
+	memcpy(&ud[12], in->type, 2);
+	memcpy(&ud[14], in->meta, 14);
+	memcpy(&ud[28], in->crc, 2);
+
+	conv_encode_packed(enc, ud, 240);
+	conv_puncture_packed(out, enc, 2*(240+4), puncture_pattern_1, sizeof(puncture_pattern_1), SYM_PER_PLD*2);
+}
+
+/**
+ * @brief Encode M17 BERT frame into packed bits, using the table-driven encoder.
+ *
+ * @param out Output - packed array of uint8_t, 368 type-3 bits.
+ * @param in Input - packed array of uint8_t, 197 type-1 bits.
+ */
+void conv_encode_bert_frame_packed(uint8_t out[SYM_PER_PLD*2/8], const uint8_t in[25])
+{
+	uint16_t enc[(197+4+7)/8];
+
+	conv_encode_packed(enc, in, 197);
+	conv_puncture_packed(out, enc, 2*(197+4), puncture_pattern_2, sizeof(puncture_pattern_2), SYM_PER_PLD*2);
+}
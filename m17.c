@@ -126,6 +126,38 @@ void gen_data_i8(int8_t out[SYM_PER_PLD], uint32_t *cnt, const uint8_t* in)
     }
 }
 
+/**
+ * @brief Generate symbol stream for frame contents from packed type-4 bits.
+ * 
+ * @param out Output buffer (184 floats).
+ * @param cnt Pointer to a variable holding the number of written symbols.
+ * @param in Data input - packed bits, MSB first (46 bytes).
+ */
+void gen_data_packed(float out[SYM_PER_PLD], uint32_t *cnt, const uint8_t in[SYM_PER_PLD*2/8])
+{
+    for(uint16_t i=0; i<SYM_PER_PLD*2/8; i++)
+    {
+        for(uint8_t j=0; j<8; j+=2)
+            out[(*cnt)++]=symbol_map[(in[i]>>(6-j))&3];
+    }
+}
+
+/**
+ * @brief Generate symbol stream for frame contents from packed type-4 bits.
+ * 
+ * @param out Output buffer (184 int8_t).
+ * @param cnt Pointer to a variable holding the number of written symbols.
+ * @param in Data input - packed bits, MSB first (46 bytes).
+ */
+void gen_data_packed_i8(int8_t out[SYM_PER_PLD], uint32_t *cnt, const uint8_t in[SYM_PER_PLD*2/8])
+{
+    for(uint16_t i=0; i<SYM_PER_PLD*2/8; i++)
+    {
+        for(uint8_t j=0; j<8; j+=2)
+            out[(*cnt)++]=symbol_map[(in[i]>>(6-j))&3];
+    }
+}
+
 /**
  * @brief Generate symbol stream for the End of Transmission marker.
  * 
@@ -155,51 +187,115 @@ void gen_eot_i8(int8_t out[SYM_PER_FRA], uint32_t *cnt)
 }
 
 /**
- * @brief Generate frame symbols.
+ * @brief Puncture packed type-2 bits straight into interleaved, randomized type-4 positions.
+ * The interleaver is its own inverse, so type-3 bit k lands at position intrl_seq[k].
  * 
- * @param out Output buffer for symbols (192 floats).
+ * @param out Output - packed type-4 bits, already holding the randomizing sequence.
+ * @param k Index of the first type-3 bit to produce.
+ * @param in Input - packed type-2 bits, as produced by conv_encode_packed().
+ * @param len Number of type-2 bits.
+ * @param punct Puncturing matrix.
+ * @param p_len Puncturing matrix length (entries).
+ */
+static void scatter_type2_bits(uint8_t out[SYM_PER_PLD*2/8], uint16_t k, const uint16_t* in, const uint16_t len, const uint8_t* punct, const uint16_t p_len)
+{
+    uint16_t p=0;
+
+    for(uint16_t i=0; i<len && k<SYM_PER_PLD*2; i++)
+    {
+        if(punct[p])
+        {
+            uint16_t d=intrl_seq[k++];
+            out[d/8]^=((in[i/16]>>(15-i%16))&1)<<(7-d%8);
+        }
+
+        if(++p==p_len)
+            p=0;
+    }
+}
+
+/**
+ * @brief Generate packed type-4 bits for frame contents (without the syncword).
+ * Convolutional encoding, puncturing, interleaving and randomization are fused
+ * into a single pass over the encoder output.
+ * 
+ * @param out Output - packed type-4 bits, MSB first (46 bytes).
  * @param data Payload (16 or 25 bytes).
- * @param type Frame type (LSF, Stream, Packet).
+ * @param type Frame type (LSF, Stream, Packet, BERT).
  * @param lsf Pointer to a structure holding Link Setup Frame data.
  * @param lich_cnt LICH counter (0..5).
  * @param fn Frame number.
  */
-void gen_frame(float out[SYM_PER_FRA], const uint8_t* data, const frame_t type, const lsf_t* lsf, const uint8_t lich_cnt, const uint16_t fn)
+void gen_frame_bits(uint8_t out[SYM_PER_PLD*2/8], const uint8_t* data, const frame_t type, const lsf_t* lsf, const uint8_t lich_cnt, const uint16_t fn)
 {
-    uint8_t lich[6];                    //48 bits packed raw, unencoded LICH
-    uint8_t lich_encoded[12];           //96 bits packed, encoded LICH
-    uint8_t enc_bits[SYM_PER_PLD*2];    //type-2 bits, unpacked
-    uint8_t rf_bits[SYM_PER_PLD*2];     //type-4 bits, unpacked
-    uint32_t sym_cnt=0;                 //symbols written counter
+    uint8_t ud[30];                     //type-1 bits, packed
+    uint16_t enc[(240+4+7)/8];          //type-2 bits, packed
+
+    memcpy(out, rand_seq, SYM_PER_PLD*2/8);
 
     if(type==FRAME_LSF)
     {
-        gen_syncword(out, &sym_cnt, SYNC_LSF);
-        conv_encode_LSF(enc_bits, lsf);
+        memcpy(&ud[0], lsf->dst, 6);
+        memcpy(&ud[6], lsf->src, 6);
+        memcpy(&ud[12], lsf->type, 2);
+        memcpy(&ud[14], lsf->meta, 14);
+        memcpy(&ud[28], lsf->crc, 2);
+        conv_encode_packed(enc, ud, 240);
+        scatter_type2_bits(out, 0, enc, 2*(240+4), puncture_pattern_1, sizeof(puncture_pattern_1));
     }
     else if(type==FRAME_STR)
     {
-        gen_syncword(out, &sym_cnt, SYNC_STR);
+        uint8_t lich[6];                //48 bits packed raw, unencoded LICH
+        uint8_t lich_encoded[12];       //96 bits packed, encoded LICH
+
         extract_LICH(lich, lich_cnt, lsf);
         encode_LICH(lich_encoded, lich);
-        unpack_LICH(enc_bits, lich_encoded);
-        conv_encode_stream_frame(&enc_bits[96], data, fn); //stream frames require 16-byte payloads
+        for(uint8_t k=0; k<96; k++)
+        {
+            uint16_t d=intrl_seq[k];
+            out[d/8]^=((lich_encoded[k/8]>>(7-k%8))&1)<<(7-d%8);
+        }
+
+        ud[0]=fn>>8;
+        ud[1]=fn&0xFF;
+        memcpy(&ud[2], data, 16); //stream frames require 16-byte payloads
+        conv_encode_packed(enc, ud, 144);
+        scatter_type2_bits(out, 96, enc, 2*(144+4), puncture_pattern_2, sizeof(puncture_pattern_2));
     }
     else if(type==FRAME_PKT)
     {
-        gen_syncword(out, &sym_cnt, SYNC_PKT);
-        conv_encode_packet_frame(enc_bits, data); //packet frames require 200-bit payload chunks plus a 6-bit counter
+        conv_encode_packed(enc, data, 206); //packet frames require 200-bit payload chunks plus a 6-bit counter
+        scatter_type2_bits(out, 0, enc, 2*(206+4), puncture_pattern_3, sizeof(puncture_pattern_3));
     }
-	else if(type==FRAME_BERT)
+    else if(type==FRAME_BERT)
     {
-        gen_syncword(out, &sym_cnt, SYNC_BER);
-        conv_encode_bert_frame(enc_bits, data); //BERT frames require 197 BERT bits packed as 25 bytes
+        conv_encode_packed(enc, data, 197); //BERT frames require 197 BERT bits packed as 25 bytes
+        scatter_type2_bits(out, 0, enc, 2*(197+4), puncture_pattern_2, sizeof(puncture_pattern_2));
     }
+}
 
-    //common stuff
-    reorder_bits(rf_bits, enc_bits);
-    randomize_bits(rf_bits);
-    gen_data(out, &sym_cnt, rf_bits);
+/**
+ * @brief Generate frame symbols.
+ * 
+ * @param out Output buffer for symbols (192 floats).
+ * @param data Payload (16 or 25 bytes).
+ * @param type Frame type (LSF, Stream, Packet).
+ * @param lsf Pointer to a structure holding Link Setup Frame data.
+ * @param lich_cnt LICH counter (0..5).
+ * @param fn Frame number.
+ */
+void gen_frame(float out[SYM_PER_FRA], const uint8_t* data, const frame_t type, const lsf_t* lsf, const uint8_t lich_cnt, const uint16_t fn)
+{
+    const uint16_t sync[]={SYNC_LSF, SYNC_STR, SYNC_PKT, SYNC_BER}; //indexed by frame type
+    uint8_t rf_bits[SYM_PER_PLD*2/8];   //type-4 bits, packed
+    uint32_t sym_cnt=0;                 //symbols written counter
+
+    if(type>FRAME_BERT) //unknown frame type
+        return;
+
+    gen_syncword(out, &sym_cnt, sync[type]);
+    gen_frame_bits(rf_bits, data, type, lsf, lich_cnt, fn);
+    gen_data_packed(out, &sym_cnt, rf_bits);
 }
 
 /**
@@ -214,61 +310,35 @@ void gen_frame(float out[SYM_PER_FRA], const uint8_t* data, const frame_t type,
  */
 void gen_frame_i8(int8_t out[SYM_PER_FRA], const uint8_t* data, const frame_t type, const lsf_t* lsf, const uint8_t lich_cnt, const uint16_t fn)
 {
-    uint8_t lich[6];                    //48 bits packed raw, unencoded LICH
-    uint8_t lich_encoded[12];           //96 bits packed, encoded LICH
-    uint8_t enc_bits[SYM_PER_PLD*2];    //type-2 bits, unpacked
-    uint8_t rf_bits[SYM_PER_PLD*2];     //type-4 bits, unpacked
+    const uint16_t sync[]={SYNC_LSF, SYNC_STR, SYNC_PKT, SYNC_BER}; //indexed by frame type
+    uint8_t rf_bits[SYM_PER_PLD*2/8];   //type-4 bits, packed
     uint32_t sym_cnt=0;                 //symbols written counter
 
-    if(type==FRAME_LSF)
-    {
-        gen_syncword_i8(out, &sym_cnt, SYNC_LSF);
-        conv_encode_LSF(enc_bits, lsf);
-    }
-    else if(type==FRAME_STR)
-    {
-        gen_syncword_i8(out, &sym_cnt, SYNC_STR);
-        extract_LICH(lich, lich_cnt, lsf);
-        encode_LICH(lich_encoded, lich);
-        unpack_LICH(enc_bits, lich_encoded);
-        conv_encode_stream_frame(&enc_bits[96], data, fn); //stream frames require 16-byte payloads
-    }
-    else if(type==FRAME_PKT)
-    {
-        gen_syncword_i8(out, &sym_cnt, SYNC_PKT);
-        conv_encode_packet_frame(enc_bits, data); //packet frames require 200-bit payload chunks plus a 6-bit counter
-    }
-    else if(type==FRAME_BERT)
-    {
-        gen_syncword_i8(out, &sym_cnt, SYNC_BER);
-        conv_encode_bert_frame(enc_bits, data); //BERT frames require 197 BERT bits packed as 25 bytes
-    }
+    if(type>FRAME_BERT) //unknown frame type
+        return;
 
-    //common stuff
-    reorder_bits(rf_bits, enc_bits);
-    randomize_bits(rf_bits);
-    gen_data_i8(out, &sym_cnt, rf_bits);
+    gen_syncword_i8(out, &sym_cnt, sync[type]);
+    gen_frame_bits(rf_bits, data, type, lsf, lich_cnt, fn);
+    gen_data_packed_i8(out, &sym_cnt, rf_bits);
 }
 
 /**
  * @brief Decode the Link Setup Frame from a symbol stream.
  *
+ * @param ctx Pointer to a Viterbi decoder context. Its options, e.g. hard decision decoding, apply.
  * @param lsf Pointer to an LSF struct.
  * @param pld_symbs Input 184 symbols represented as floats: {-3, -1, +1, +3}.
  * @return uint32_t Viterbi metric for the payload.
  */
-uint32_t decode_LSF(lsf_t* lsf, const float pld_symbs[SYM_PER_PLD])
+uint32_t decode_LSF_ctx(viterbi_t* ctx, lsf_t* lsf, const float pld_symbs[SYM_PER_PLD])
 {
 	uint8_t lsf_b[30+1];
-	uint16_t soft_bit[2*SYM_PER_PLD];
 	uint16_t d_soft_bit[2*SYM_PER_PLD];
 	uint32_t e;
 
-	slice_symbols(soft_bit, pld_symbs);
-	randomize_soft_bits(soft_bit);
-	reorder_soft_bits(d_soft_bit, soft_bit);
+	slice_symbols_fused(d_soft_bit, pld_symbs);
 
-	e = viterbi_decode_punctured(lsf_b, d_soft_bit, puncture_pattern_1, 2*SYM_PER_PLD, sizeof(puncture_pattern_1));
+	e = viterbi_decode_punctured_ctx(ctx, lsf_b, d_soft_bit, puncture_pattern_1, 2*SYM_PER_PLD, sizeof(puncture_pattern_1));
 
 	//copy over the data starting at byte 1 (byte 0 needs to be omitted)
 	memcpy(lsf->dst, &lsf_b[1+0], 6);		//DST field
@@ -285,6 +355,8 @@ uint32_t decode_LSF(lsf_t* lsf, const float pld_symbs[SYM_PER_PLD])
 /**
  * @brief Decode a single Stream Frame from a symbol stream.
  *
+ * @param ctx Pointer to a Viterbi decoder context. Its options, e.g. hard decision decoding, apply.
+ * @param cache Pointer to the LICH cache of the stream, NULL for none.
  * @param frame_data Pointer to a 16-byte array for the decoded payload.
  * @param lich Pointer to a 5-byte array for the decoded LICH data chunk.
  * @param fn Pointer to a uint16_t variable for the Frame Number.
@@ -292,25 +364,25 @@ uint32_t decode_LSF(lsf_t* lsf, const float pld_symbs[SYM_PER_PLD])
  * @param pld_symbs Input 184 symbols represented as floats: {-3, -1, +1, +3}.
  * @return uint32_t Viterbi metric for the payload.
  */
-uint32_t decode_str_frame(uint8_t frame_data[16], uint8_t lich[5], uint16_t* fn, uint8_t* lich_cnt, const float pld_symbs[SYM_PER_PLD])
+static uint32_t str_frame_decode(viterbi_t* ctx, lich_cache_t* cache, uint8_t frame_data[16], uint8_t lich[5], uint16_t* fn, uint8_t* lich_cnt, const float pld_symbs[SYM_PER_PLD])
 {
-	uint16_t soft_bit[2*SYM_PER_PLD];
 	uint16_t d_soft_bit[2*SYM_PER_PLD];
 	uint8_t tmp_frame_data[(16+128)/8+1]; //1 byte extra for flushing
 	uint32_t e;
 
-	slice_symbols(soft_bit, pld_symbs);
-	randomize_soft_bits(soft_bit);
-	reorder_soft_bits(d_soft_bit, soft_bit);
+	slice_symbols_fused(d_soft_bit, pld_symbs);
 
 	//decode LICH
     uint8_t tmp[6];
-	decode_LICH(tmp, d_soft_bit);
+	if(cache!=NULL)
+		decode_LICH_cached(cache, tmp, d_soft_bit);
+	else
+		decode_LICH(tmp, d_soft_bit);
     memcpy(lich, tmp, 5);
 
 	if(lich_cnt!=NULL) *lich_cnt = tmp[5]>>5;
 
-	e = viterbi_decode_punctured(tmp_frame_data, &d_soft_bit[96], puncture_pattern_2, 2*SYM_PER_PLD-96, sizeof(puncture_pattern_2));
+	e = viterbi_decode_punctured_ctx(ctx, tmp_frame_data, &d_soft_bit[96], puncture_pattern_2, 2*SYM_PER_PLD-96, sizeof(puncture_pattern_2));
 	
 	//shift 1+2 positions left - get rid of the encoded flushing bits and FN
     memcpy(frame_data, &tmp_frame_data[1+2], 16);
@@ -320,27 +392,59 @@ uint32_t decode_str_frame(uint8_t frame_data[16], uint8_t lich[5], uint16_t* fn,
 	return e;
 }
 
+/**
+ * @brief Decode a single Stream Frame from a symbol stream.
+ *
+ * @param ctx Pointer to a Viterbi decoder context. Its options, e.g. hard decision decoding, apply.
+ * @param frame_data Pointer to a 16-byte array for the decoded payload.
+ * @param lich Pointer to a 5-byte array for the decoded LICH data chunk.
+ * @param fn Pointer to a uint16_t variable for the Frame Number.
+ * @param lich_cnt Pointer to a uint8_t variable for the LICH Counter.
+ * @param pld_symbs Input 184 symbols represented as floats: {-3, -1, +1, +3}.
+ * @return uint32_t Viterbi metric for the payload.
+ */
+uint32_t decode_str_frame_ctx(viterbi_t* ctx, uint8_t frame_data[16], uint8_t lich[5], uint16_t* fn, uint8_t* lich_cnt, const float pld_symbs[SYM_PER_PLD])
+{
+	return str_frame_decode(ctx, NULL, frame_data, lich, fn, lich_cnt, pld_symbs);
+}
+
+/**
+ * @brief Decode a single Stream Frame from a symbol stream, with LICH caching.
+ * Same as decode_str_frame_ctx(), but the LICH goes through decode_LICH_cached().
+ *
+ * @param ctx Pointer to a Viterbi decoder context. Its options, e.g. hard decision decoding, apply.
+ * @param cache Pointer to the LICH cache of the stream.
+ * @param frame_data Pointer to a 16-byte array for the decoded payload.
+ * @param lich Pointer to a 5-byte array for the decoded LICH data chunk.
+ * @param fn Pointer to a uint16_t variable for the Frame Number.
+ * @param lich_cnt Pointer to a uint8_t variable for the LICH Counter.
+ * @param pld_symbs Input 184 symbols represented as floats: {-3, -1, +1, +3}.
+ * @return uint32_t Viterbi metric for the payload.
+ */
+uint32_t decode_str_frame_cached(viterbi_t* ctx, lich_cache_t* cache, uint8_t frame_data[16], uint8_t lich[5], uint16_t* fn, uint8_t* lich_cnt, const float pld_symbs[SYM_PER_PLD])
+{
+	return str_frame_decode(ctx, cache, frame_data, lich, fn, lich_cnt, pld_symbs);
+}
+
 /**
  * @brief Decode a single Packet Frame from a symbol stream.
  *
+ * @param ctx Pointer to a Viterbi decoder context. Its options, e.g. hard decision decoding, apply.
  * @param frame_data Pointer to a 25-byte array for the decoded payload.
  * @param eof Pointer to a uint8_t variable for the End of Frame marker.
  * @param fn Pointer to a uint8_t variable for the Frame Number.
  * @param pld_symbs Input 184 symbols represented as floats: {-3, -1, +1, +3}.
  * @return uint32_t Viterbi metric for the payload.
  */
-uint32_t decode_pkt_frame(uint8_t frame_data[25], uint8_t* eof, uint8_t* fn, const float pld_symbs[SYM_PER_PLD])
+uint32_t decode_pkt_frame_ctx(viterbi_t* ctx, uint8_t frame_data[25], uint8_t* eof, uint8_t* fn, const float pld_symbs[SYM_PER_PLD])
 {
-	uint16_t soft_bit[2*SYM_PER_PLD];
 	uint16_t d_soft_bit[2*SYM_PER_PLD];
 	uint8_t tmp_frame_data[26+1]; //1 byte extra for flushing
 	uint32_t e;
 
-	slice_symbols(soft_bit, pld_symbs);
-	randomize_soft_bits(soft_bit);
-	reorder_soft_bits(d_soft_bit, soft_bit);
+	slice_symbols_fused(d_soft_bit, pld_symbs);
 
-	e = viterbi_decode_punctured(tmp_frame_data, d_soft_bit, puncture_pattern_3, 2*SYM_PER_PLD, sizeof(puncture_pattern_3));
+	e = viterbi_decode_punctured_ctx(ctx, tmp_frame_data, d_soft_bit, puncture_pattern_3, 2*SYM_PER_PLD, sizeof(puncture_pattern_3));
 	
 	//shift 1 position left - get rid of the encoded flushing bits
     memcpy(frame_data, &tmp_frame_data[1], 25);
@@ -350,3 +454,378 @@ uint32_t decode_pkt_frame(uint8_t frame_data[25], uint8_t* eof, uint8_t* fn, con
 
 	return e;
 }
+
+/**
+ * @brief Decode the Link Setup Frame from a symbol stream, int8 LLR pipeline.
+ * Lighter alternative to decode_LSF_ctx() for resource constrained targets.
+ *
+ * @param ctx Pointer to a Viterbi decoder context. Its options do not apply.
+ * @param lsf Pointer to an LSF struct.
+ * @param pld_symbs Input 184 symbols represented as floats: {-3, -1, +1, +3}.
+ * @return uint32_t Viterbi metric for the payload, 14 per fully flipped bit.
+ */
+uint32_t decode_LSF_llr(viterbi_t* ctx, lsf_t* lsf, const float pld_symbs[SYM_PER_PLD])
+{
+	uint8_t lsf_b[30+1];
+	int8_t llr[2*SYM_PER_PLD];
+	int8_t d_llr[2*SYM_PER_PLD];
+	uint32_t e;
+
+	slice_symbols_llr(llr, pld_symbs);
+	randomize_llr(llr);
+	reorder_llr(d_llr, llr);
+
+	e = viterbi_decode_punctured_llr(ctx, lsf_b, d_llr, puncture_pattern_1, 2*SYM_PER_PLD, sizeof(puncture_pattern_1));
+
+	//copy over the data starting at byte 1 (byte 0 needs to be omitted)
+	memcpy(lsf->dst, &lsf_b[1+0], 6);		//DST field
+	memcpy(lsf->src, &lsf_b[1+6], 6);		//SRC field
+	lsf->type[0]=lsf_b[1+12];				//TYPE field
+	lsf->type[1]=lsf_b[1+13];
+	memcpy(lsf->meta, &lsf_b[1+14], 14);	//META field
+	lsf->crc[0]=lsf_b[1+28];				//CRC field
+	lsf->crc[1]=lsf_b[1+29];
+
+	return e; //return Viterbi error metric
+}
+
+/**
+ * @brief Decode a single Stream Frame from a symbol stream, int8 LLR pipeline.
+ *
+ * @param ctx Pointer to a Viterbi decoder context. Its options do not apply.
+ * @param frame_data Pointer to a 16-byte array for the decoded payload.
+ * @param lich Pointer to a 5-byte array for the decoded LICH data chunk.
+ * @param fn Pointer to a uint16_t variable for the Frame Number.
+ * @param lich_cnt Pointer to a uint8_t variable for the LICH Counter.
+ * @param pld_symbs Input 184 symbols represented as floats: {-3, -1, +1, +3}.
+ * @return uint32_t Viterbi metric for the payload, 14 per fully flipped bit.
+ */
+uint32_t decode_str_frame_llr(viterbi_t* ctx, uint8_t frame_data[16], uint8_t lich[5], uint16_t* fn, uint8_t* lich_cnt, const float pld_symbs[SYM_PER_PLD])
+{
+	int8_t llr[2*SYM_PER_PLD];
+	int8_t d_llr[2*SYM_PER_PLD];
+	uint8_t tmp_frame_data[(16+128)/8+1]; //1 byte extra for flushing
+	uint32_t e;
+
+	slice_symbols_llr(llr, pld_symbs);
+	randomize_llr(llr);
+	reorder_llr(d_llr, llr);
+
+	//decode LICH
+    uint8_t tmp[6];
+	decode_LICH_llr(tmp, d_llr);
+    memcpy(lich, tmp, 5);
+
+	if(lich_cnt!=NULL) *lich_cnt = tmp[5]>>5;
+
+	e = viterbi_decode_punctured_llr(ctx, tmp_frame_data, &d_llr[96], puncture_pattern_2, 2*SYM_PER_PLD-96, sizeof(puncture_pattern_2));
+
+	//shift 1+2 positions left - get rid of the encoded flushing bits and FN
+    memcpy(frame_data, &tmp_frame_data[1+2], 16);
+
+	if(fn!=NULL) *fn = (tmp_frame_data[1]<<8)|tmp_frame_data[2];
+
+	return e;
+}
+
+/**
+ * @brief Decode a single Packet Frame from a symbol stream, int8 LLR pipeline.
+ *
+ * @param ctx Pointer to a Viterbi decoder context. Its options do not apply.
+ * @param frame_data Pointer to a 25-byte array for the decoded payload.
+ * @param eof Pointer to a uint8_t variable for the End of Frame marker.
+ * @param fn Pointer to a uint8_t variable for the Frame Number.
+ * @param pld_symbs Input 184 symbols represented as floats: {-3, -1, +1, +3}.
+ * @return uint32_t Viterbi metric for the payload, 14 per fully flipped bit.
+ */
+uint32_t decode_pkt_frame_llr(viterbi_t* ctx, uint8_t frame_data[25], uint8_t* eof, uint8_t* fn, const float pld_symbs[SYM_PER_PLD])
+{
+	int8_t llr[2*SYM_PER_PLD];
+	int8_t d_llr[2*SYM_PER_PLD];
+	uint8_t tmp_frame_data[26+1]; //1 byte extra for flushing
+	uint32_t e;
+
+	slice_symbols_llr(llr, pld_symbs);
+	randomize_llr(llr);
+	reorder_llr(d_llr, llr);
+
+	e = viterbi_decode_punctured_llr(ctx, tmp_frame_data, d_llr, puncture_pattern_3, 2*SYM_PER_PLD, sizeof(puncture_pattern_3));
+
+	//shift 1 position left - get rid of the encoded flushing bits
+    memcpy(frame_data, &tmp_frame_data[1], 25);
+
+	if(fn!=NULL) *fn = (tmp_frame_data[26]>>2)&0x1F;
+    if(eof!=NULL) *eof = tmp_frame_data[26]>>7;
+
+	return e;
+}
+
+/**
+ * @brief Decode the Link Setup Frame from a symbol stream.
+ * Uses a decoder context local to the call.
+ *
+ * @param lsf Pointer to an LSF struct.
+ * @param pld_symbs Input 184 symbols represented as floats: {-3, -1, +1, +3}.
+ * @return uint32_t Viterbi metric for the payload.
+ */
+uint32_t decode_LSF(lsf_t* lsf, const float pld_symbs[SYM_PER_PLD])
+{
+	viterbi_t ctx;
+
+	viterbi_init(&ctx);
+
+	return decode_LSF_ctx(&ctx, lsf, pld_symbs);
+}
+
+/**
+ * @brief Decode a single Stream Frame from a symbol stream.
+ * Uses a decoder context local to the call.
+ *
+ * @param frame_data Pointer to a 16-byte array for the decoded payload.
+ * @param lich Pointer to a 5-byte array for the decoded LICH data chunk.
+ * @param fn Pointer to a uint16_t variable for the Frame Number.
+ * @param lich_cnt Pointer to a uint8_t variable for the LICH Counter.
+ * @param pld_symbs Input 184 symbols represented as floats: {-3, -1, +1, +3}.
+ * @return uint32_t Viterbi metric for the payload.
+ */
+uint32_t decode_str_frame(uint8_t frame_data[16], uint8_t lich[5], uint16_t* fn, uint8_t* lich_cnt, const float pld_symbs[SYM_PER_PLD])
+{
+	viterbi_t ctx;
+
+	viterbi_init(&ctx);
+
+	return decode_str_frame_ctx(&ctx, frame_data, lich, fn, lich_cnt, pld_symbs);
+}
+
+/**
+ * @brief Decode a single Packet Frame from a symbol stream.
+ * Uses a decoder context local to the call.
+ *
+ * @param frame_data Pointer to a 25-byte array for the decoded payload.
+ * @param eof Pointer to a uint8_t variable for the End of Frame marker.
+ * @param fn Pointer to a uint8_t variable for the Frame Number.
+ * @param pld_symbs Input 184 symbols represented as floats: {-3, -1, +1, +3}.
+ * @return uint32_t Viterbi metric for the payload.
+ */
+uint32_t decode_pkt_frame(uint8_t frame_data[25], uint8_t* eof, uint8_t* fn, const float pld_symbs[SYM_PER_PLD])
+{
+	viterbi_t ctx;
+
+	viterbi_init(&ctx);
+
+	return decode_pkt_frame_ctx(&ctx, frame_data, eof, fn, pld_symbs);
+}
+
+/**
+ * @brief Decode a batch of Link Setup Frames at once.
+ * Results are identical to calling `decode_LSF()` for each frame.
+ *
+ * @param ctx Pointer to a batch Viterbi decoder context.
+ * @param lsf Array of n LSF structs.
+ * @param e Array of n Viterbi metrics.
+ * @param pld_symbs Array of n pointers to 184 payload symbols each.
+ * @param n Number of frames, 1 to M17_VITERBI_BATCH_MAX.
+ * @return int8_t 0 on success, -1 on invalid batch size.
+ */
+int8_t decode_LSF_batch(viterbi_batch_t* ctx, lsf_t lsf[], uint32_t e[], const float* const pld_symbs[], uint8_t n)
+{
+	uint8_t lsf_b[M17_VITERBI_BATCH_MAX][30+1];
+	uint8_t* out[M17_VITERBI_BATCH_MAX];
+	const uint16_t* in[M17_VITERBI_BATCH_MAX];
+
+	if(n == 0 || n > M17_VITERBI_BATCH_MAX)
+		return -1;
+
+	for(uint8_t i=0; i<n; i++)
+	{
+		slice_symbols_fused(ctx->soft[i], pld_symbs[i]);
+
+		out[i] = lsf_b[i];
+		in[i] = ctx->soft[i];
+	}
+
+	if(viterbi_decode_punctured_batch(ctx, out, e, in, puncture_pattern_1, 2*SYM_PER_PLD, sizeof(puncture_pattern_1), n))
+		return -1;
+
+	for(uint8_t i=0; i<n; i++)
+	{
+		//copy over the data starting at byte 1 (byte 0 needs to be omitted)
+		memcpy(lsf[i].dst, &lsf_b[i][1+0], 6);		//DST field
+		memcpy(lsf[i].src, &lsf_b[i][1+6], 6);		//SRC field
+		lsf[i].type[0]=lsf_b[i][1+12];				//TYPE field
+		lsf[i].type[1]=lsf_b[i][1+13];
+		memcpy(lsf[i].meta, &lsf_b[i][1+14], 14);	//META field
+		lsf[i].crc[0]=lsf_b[i][1+28];				//CRC field
+		lsf[i].crc[1]=lsf_b[i][1+29];
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Decode a batch of Stream Frames at once.
+ * Results are identical to calling `decode_str_frame()` for each frame.
+ *
+ * @param ctx Pointer to a batch Viterbi decoder context.
+ * @param frame_data Array of n 16-byte arrays for the decoded payloads.
+ * @param lich Array of n 5-byte arrays for the decoded LICH data chunks.
+ * @param fn Array of n Frame Numbers. Can be NULL.
+ * @param lich_cnt Array of n LICH Counters. Can be NULL.
+ * @param e Array of n Viterbi metrics.
+ * @param pld_symbs Array of n pointers to 184 payload symbols each.
+ * @param n Number of frames, 1 to M17_VITERBI_BATCH_MAX.
+ * @return int8_t 0 on success, -1 on invalid batch size.
+ */
+int8_t decode_str_frame_batch(viterbi_batch_t* ctx, uint8_t frame_data[][16], uint8_t lich[][5], uint16_t fn[], uint8_t lich_cnt[],
+	uint32_t e[], const float* const pld_symbs[], uint8_t n)
+{
+	uint8_t tmp_frame_data[M17_VITERBI_BATCH_MAX][(16+128)/8+1]; //1 byte extra for flushing
+	uint8_t* out[M17_VITERBI_BATCH_MAX];
+	const uint16_t* in[M17_VITERBI_BATCH_MAX];
+
+	if(n == 0 || n > M17_VITERBI_BATCH_MAX)
+		return -1;
+
+	for(uint8_t i=0; i<n; i++)
+	{
+		slice_symbols_fused(ctx->soft[i], pld_symbs[i]);
+
+		out[i] = tmp_frame_data[i];
+		in[i] = &ctx->soft[i][96];
+	}
+
+	//decode LICH of all frames
+	uint8_t tmp[M17_VITERBI_BATCH_MAX][6];
+	decode_LICH_batch(tmp, ctx->soft[0], SYM_PER_PLD*2, n);
+	for(uint8_t i=0; i<n; i++)
+	{
+		memcpy(lich[i], tmp[i], 5);
+
+		if(lich_cnt!=NULL) lich_cnt[i] = tmp[i][5]>>5;
+	}
+
+	if(viterbi_decode_punctured_batch(ctx, out, e, in, puncture_pattern_2, 2*SYM_PER_PLD-96, sizeof(puncture_pattern_2), n))
+		return -1;
+
+	for(uint8_t i=0; i<n; i++)
+	{
+		//shift 1+2 positions left - get rid of the encoded flushing bits and FN
+		memcpy(frame_data[i], &tmp_frame_data[i][1+2], 16);
+
+		if(fn!=NULL) fn[i] = (tmp_frame_data[i][1]<<8)|tmp_frame_data[i][2];
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Decode a batch of Packet Frames at once.
+ * Results are identical to calling `decode_pkt_frame()` for each frame.
+ *
+ * @param ctx Pointer to a batch Viterbi decoder context.
+ * @param frame_data Array of n 25-byte arrays for the decoded payloads.
+ * @param eof Array of n End of Frame markers. Can be NULL.
+ * @param fn Array of n Frame Numbers. Can be NULL.
+ * @param e Array of n Viterbi metrics.
+ * @param pld_symbs Array of n pointers to 184 payload symbols each.
+ * @param n Number of frames, 1 to M17_VITERBI_BATCH_MAX.
+ * @return int8_t 0 on success, -1 on invalid batch size.
+ */
+int8_t decode_pkt_frame_batch(viterbi_batch_t* ctx, uint8_t frame_data[][25], uint8_t eof[], uint8_t fn[],
+	uint32_t e[], const float* const pld_symbs[], uint8_t n)
+{
+	uint8_t tmp_frame_data[M17_VITERBI_BATCH_MAX][26+1]; //1 byte extra for flushing
+	uint8_t* out[M17_VITERBI_BATCH_MAX];
+	const uint16_t* in[M17_VITERBI_BATCH_MAX];
+
+	if(n == 0 || n > M17_VITERBI_BATCH_MAX)
+		return -1;
+
+	for(uint8_t i=0; i<n; i++)
+	{
+		slice_symbols_fused(ctx->soft[i], pld_symbs[i]);
+
+		out[i] = tmp_frame_data[i];
+		in[i] = ctx->soft[i];
+	}
+
+	if(viterbi_decode_punctured_batch(ctx, out, e, in, puncture_pattern_3, 2*SYM_PER_PLD, sizeof(puncture_pattern_3), n))
+		return -1;
+
+	for(uint8_t i=0; i<n; i++)
+	{
+		//shift 1 position left - get rid of the encoded flushing bits
+		memcpy(frame_data[i], &tmp_frame_data[i][1], 25);
+
+		if(fn!=NULL) fn[i] = (tmp_frame_data[i][26]>>2)&0x1F;
+		if(eof!=NULL) eof[i] = tmp_frame_data[i][26]>>7;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Decode the Link Setup Frame from a symbol stream, with per-bit reliabilities.
+ * Pass the reliabilities to `CRC_M17_chase()` to attempt recovering an LSF with a bad CRC.
+ *
+ * @param ctx Pointer to a SOVA decoder context.
+ * @param lsf Pointer to an LSF struct.
+ * @param rel Reliabilities of the 240 bits of the LSF struct, MSB of lsf->dst[0] first.
+ * @param pld_symbs Input 184 symbols represented as floats: {-3, -1, +1, +3}.
+ * @return uint32_t Viterbi metric for the payload.
+ */
+uint32_t decode_LSF_sova(viterbi_sova_t* ctx, lsf_t* lsf, uint16_t rel[240], const float pld_symbs[SYM_PER_PLD])
+{
+	uint8_t lsf_b[30+1];
+	uint16_t d_soft_bit[2*SYM_PER_PLD];
+	uint32_t e;
+
+	slice_symbols_fused(d_soft_bit, pld_symbs);
+
+	e = viterbi_decode_punctured_sova(ctx, lsf_b, rel, d_soft_bit, puncture_pattern_1, 2*SYM_PER_PLD, sizeof(puncture_pattern_1));
+
+	//copy over the data starting at byte 1 (byte 0 needs to be omitted)
+	memcpy(lsf->dst, &lsf_b[1+0], 6);		//DST field
+	memcpy(lsf->src, &lsf_b[1+6], 6);		//SRC field
+	lsf->type[0]=lsf_b[1+12];				//TYPE field
+	lsf->type[1]=lsf_b[1+13];
+	memcpy(lsf->meta, &lsf_b[1+14], 14);	//META field
+	lsf->crc[0]=lsf_b[1+28];				//CRC field
+	lsf->crc[1]=lsf_b[1+29];
+
+	return e; //return Viterbi error metric
+}
+
+/**
+ * @brief Decode a single Packet Frame from a symbol stream, with per-bit reliabilities.
+ * Reliabilities of the frames of a packet can be concatenated and passed to
+ * `CRC_M17_chase()` along with the packet, to attempt recovering a packet with a bad CRC.
+ *
+ * @param ctx Pointer to a SOVA decoder context.
+ * @param frame_data Pointer to a 25-byte array for the decoded payload.
+ * @param eof Pointer to a uint8_t variable for the End of Frame marker.
+ * @param fn Pointer to a uint8_t variable for the Frame Number.
+ * @param rel Reliabilities of the 200 payload bits, MSB of frame_data[0] first.
+ * @param pld_symbs Input 184 symbols represented as floats: {-3, -1, +1, +3}.
+ * @return uint32_t Viterbi metric for the payload.
+ */
+uint32_t decode_pkt_frame_sova(viterbi_sova_t* ctx, uint8_t frame_data[25], uint8_t* eof, uint8_t* fn, uint16_t rel[200], const float pld_symbs[SYM_PER_PLD])
+{
+	uint16_t d_soft_bit[2*SYM_PER_PLD];
+	uint8_t tmp_frame_data[26+1]; //1 byte extra for flushing
+	uint16_t tmp_rel[200+6];
+	uint32_t e;
+
+	slice_symbols_fused(d_soft_bit, pld_symbs);
+
+	e = viterbi_decode_punctured_sova(ctx, tmp_frame_data, tmp_rel, d_soft_bit, puncture_pattern_3, 2*SYM_PER_PLD, sizeof(puncture_pattern_3));
+
+	//shift 1 position left - get rid of the encoded flushing bits
+	memcpy(frame_data, &tmp_frame_data[1], 25);
+	memcpy(rel, tmp_rel, 200*sizeof(uint16_t));
+
+	if(fn!=NULL) *fn = (tmp_frame_data[26]>>2)&0x1F;
+	if(eof!=NULL) *eof = tmp_frame_data[26]>>7;
+
+	return e;
+}
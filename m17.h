@@ -94,6 +94,255 @@ typedef struct
 	uint8_t crc[2];
 } lsf_t;
 
+// M17 C library - LICH cache
+#define M17_LICH_CACHE_SIZE			6		//one entry per LICH chunk of a superframe
+
+/**
+ * @brief LICH decoder cache for a single stream.
+ * Maps hard decisions of the 96 encoded LICH bits to the decoded 48 bits,
+ * so that the 6 chunks cycling over a transmission are Golay decoded only once.
+ */
+typedef struct
+{
+	uint32_t key[M17_LICH_CACHE_SIZE][4];	//hard decisions of the four Golay codewords
+	uint8_t lich[M17_LICH_CACHE_SIZE][6];	//decoded LICH
+	uint8_t used;							//number of valid entries
+	uint8_t next;							//entry replaced on the next insertion
+	uint32_t hits;
+	uint32_t misses;
+} lich_cache_t;
+
+// M17 C library - RRC filters
+#define M17_RRC_PHASE_TAPS			9		//taps per polyphase branch (span of 8 symbols, plus 1)
+#define M17_RRC_SPS_MAX				12		//highest samples per symbol value, rounded up to a multiple of 4
+
+/**
+ * @brief Streaming polyphase RRC interpolator (TX).
+ * Turns symbols into baseband samples at 5 (24kHz) or 10 (48kHz) samples per symbol.
+ */
+typedef struct
+{
+	float taps[M17_RRC_PHASE_TAPS][M17_RRC_SPS_MAX];	//polyphase taps, transposed: [tap][phase]
+	float hist[2*M17_RRC_PHASE_TAPS];					//last symbols, newest first, stored twice
+	uint8_t pos;										//newest symbol in hist
+	uint8_t sps;										//samples per symbol
+} rrc_interp_t;
+
+#define M17_RRC_TAPS_MAX			84		//taps of the longest RRC filter (8*10+1), rounded up to a multiple of 4
+#define M17_RRC_DECIM_BLOCK			240		//input samples filtered per chunk
+
+/**
+ * @brief Streaming RRC matched filter and decimator (RX).
+ * Filters 24kHz or 48kHz baseband and outputs one sample per symbol.
+ */
+typedef struct
+{
+	float taps[M17_RRC_TAPS_MAX];						//time reversed taps, zero padded at the front
+	float buf[M17_RRC_TAPS_MAX-1+M17_RRC_DECIM_BLOCK];	//sample history, oldest first, followed by the current chunk
+	uint8_t n_taps;										//number of taps, a multiple of 4
+	uint8_t sps;										//samples per symbol
+	uint8_t phase;										//symbol centre within a symbol period
+	uint8_t cnt;										//samples left until the next symbol centre
+} rrc_decim_t;
+
+#define M17_SYNC_ALPHA				0.01f	//default smoothing factor of the per-phase energy estimates
+
+/**
+ * @brief Symbol timing recovery (RX), max-energy phase selector.
+ * Matched filters 24kHz or 48kHz baseband and outputs 4800 symbols per second,
+ * taken at the peak of the smoothed matched filter output energy.
+ */
+typedef struct
+{
+	float taps[M17_RRC_TAPS_MAX];						//time reversed taps, zero padded at the front
+	float buf[M17_RRC_TAPS_MAX-1+M17_RRC_DECIM_BLOCK];	//sample history, oldest first, followed by the current chunk
+	float mf[M17_RRC_DECIM_BLOCK];						//matched filter output of the current chunk
+	float energy[M17_RRC_SPS_MAX];						//smoothed matched filter output energy, per phase
+	float cs[M17_RRC_SPS_MAX], sn[M17_RRC_SPS_MAX];		//cosine and sine of each phase, for the energy peak fit
+	float alpha;										//smoothing factor, defaults to M17_SYNC_ALPHA
+	uint8_t n_taps;										//number of taps, a multiple of 4
+	uint8_t sps;										//samples per symbol
+	uint8_t phase;										//current timing estimate: symbol centre within a symbol period
+	uint8_t idx;										//position of the next input sample within a symbol period
+	uint8_t cnt;										//samples left until the next symbol centre
+} symbol_sync_t;
+
+// M17 C library - syncword detector
+#define M17_SYNC_TYPES				5		//number of detected syncwords, EOT marker included
+#define M17_SYNC_DIST_MAX			2.0f	//default detection threshold: L2 norm between received symbols and a syncword
+#define M17_SYNC_TRACK_WIN			2		//default tracking window: symbols checked on each side of the predicted syncword
+#define M17_SYNC_TRACK_WIN_MAX		4		//widest tracking window
+#define M17_SYNC_TRACK_MISSES		3		//default number of missed syncwords before falling back to acquisition
+#define M17_SYNC_HIST				(SYM_PER_FRA-1+2*M17_SYNC_TRACK_WIN_MAX)	//symbols kept from previous calls
+#define M17_SYNC_BUF				(M17_SYNC_HIST+4*SYM_PER_FRA)			//history buffer size, compacted when full
+
+/**
+ * @brief Syncword type (0 - LSF, 1 - stream, 2 - packet, 3 - BERT, 4 - EOT marker).
+ * Values up to BERT match `frame_t`.
+ */
+typedef enum
+{
+	SWD_LSF,
+	SWD_STR,
+	SWD_PKT,
+	SWD_BERT,
+	SWD_EOT
+} syncword_t;
+
+/**
+ * @brief Syncword detector mode.
+ */
+typedef enum
+{
+	SYNC_ACQUIRE,										//searching for a syncword at every offset
+	SYNC_TRACK											//locked, only checking around the predicted next syncword
+} sync_mode_t;
+
+/**
+ * @brief Syncword detection result.
+ */
+typedef struct
+{
+	syncword_t type;									//detected syncword
+	uint32_t offset;									//index of the first syncword symbol in the input stream
+	float dist;											//L2 norm between the received symbols and the syncword, lower is better
+} sync_hit_t;
+
+/**
+ * @brief Syncword detector callback.
+ * Called once the whole frame has been received.
+ *
+ * @param hit Detection result.
+ * @param pld_symbs Payload symbols following the syncword, in the detector's history or in the caller's input.
+ *   Only valid during the call.
+ * @param user User pointer, as passed to `sync_detect_init()`.
+ */
+typedef void (*sync_cb_t)(const sync_hit_t* hit, const float pld_symbs[SYM_PER_PLD], void* user);
+
+/**
+ * @brief Streaming syncword detector.
+ * Tests every symbol offset against all syncwords at once.
+ */
+typedef struct
+{
+	float sync[M17_SYNC_TYPES][SYM_PER_SWD];			//syncword symbols
+	float nrm[M17_SYNC_TYPES];							//squared L2 norm of each syncword
+	float buf[M17_SYNC_BUF];							//symbol history, oldest first, new input is appended
+	float thresh;										//detection threshold
+	sync_cb_t cb;										//frame callback
+	void* user;											//user pointer passed to the callback
+	uint32_t cnt;										//number of symbols consumed so far
+	uint16_t pos;										//end of the symbol history in buf
+	uint16_t skip;										//offsets left to skip: the rest of a detected frame, or up to the end of the tracking window
+	sync_mode_t mode;									//acquisition or tracking
+	uint8_t window;										//tracking window: symbols checked on each side of the predicted syncword
+	uint8_t max_misses;									//missed syncwords before falling back to acquisition, 0 disables tracking
+	uint8_t misses;										//consecutive missed syncwords
+} sync_detect_t;
+
+// M17 C library - Viterbi decoder
+#define M17_CONVOL_K				5									//constraint length K=5
+#define M17_CONVOL_STATES	        (1 << (M17_CONVOL_K - 1))			//number of states of the convolutional encoder
+#define M17_VITERBI_HIST_LEN		244
+#define M17_VITERBI_HIST_LEN_2		(2*M17_VITERBI_HIST_LEN)
+#define M17_LLR_MAX					127									//int8 LLR of a certain 1, -M17_LLR_MAX is a certain 0, 0 is an erasure
+
+/**
+ * @brief Add-compare-select kernel used by the Viterbi decoder.
+ * All kernels produce bit-exact results.
+ */
+typedef enum
+{
+	VITERBI_KERNEL_AUTO,	//pick the fastest one available
+	VITERBI_KERNEL_SCALAR,	//portable reference
+	VITERBI_KERNEL_SSE2,
+	VITERBI_KERNEL_AVX2,
+	VITERBI_KERNEL_NEON
+} viterbi_kernel_t;
+
+#define M17_VITERBI_OPT_HARD		(1<<0)	//try hard decision decoding first
+#define M17_VITERBI_OPT_SHORTCUT	(1<<1)	//skip the trellis if the hard decisions form a valid codeword
+
+/**
+ * @brief Decoding path taken by `viterbi_decode_punctured_ctx()`.
+ */
+typedef enum
+{
+	VITERBI_PATH_SOFT,		//full soft decision trellis
+	VITERBI_PATH_HARD,		//hard decision trellis
+	VITERBI_PATH_SHORTCUT,	//error-free input, no trellis at all
+	VITERBI_PATH_CNT
+} viterbi_path_t;
+
+/**
+ * @brief Viterbi decoder context.
+ * Holds the whole trellis state, so that independent decoders
+ * can run concurrently, e.g. one per thread.
+ */
+typedef struct
+{
+	uint32_t metricsA[M17_CONVOL_STATES];
+	uint32_t metricsB[M17_CONVOL_STATES];
+	uint16_t history[M17_VITERBI_HIST_LEN];
+	uint32_t *prevMetrics;
+	uint32_t *currMetrics;
+	viterbi_kernel_t kernel;
+	uint8_t opts;				//M17_VITERBI_OPT_* flags
+	uint16_t hard_max_err;		//hard decision errors accepted before falling back to soft decoding
+	viterbi_path_t last_path;	//path taken by the last decode
+	uint32_t path_cnt[VITERBI_PATH_CNT];	//number of decodes per path
+} viterbi_t;
+
+#define M17_VITERBI_BATCH_MAX		32		//max number of frames decoded at once
+
+/**
+ * @brief Batch Viterbi decoder context.
+ * Decodes up to M17_VITERBI_BATCH_MAX frames of the same type at once,
+ * one frame per SIMD lane. Metrics and history are stored lane-minor.
+ */
+typedef struct
+{
+	uint32_t metrics[2][M17_CONVOL_STATES][M17_VITERBI_BATCH_MAX];
+	uint16_t history[M17_VITERBI_HIST_LEN][M17_VITERBI_BATCH_MAX];
+	uint16_t soft[M17_VITERBI_BATCH_MAX][SYM_PER_PLD*2];	//scratch space for frame decoders
+	viterbi_kernel_t kernel;
+} viterbi_batch_t;
+
+#define M17_VITERBI_STREAM_DEPTH_MAX	(M17_VITERBI_HIST_LEN/2)	//max traceback depth of the streaming decoder
+
+/**
+ * @brief Streaming (sliding window) Viterbi decoder context.
+ * Accepts input of any length in chunks and emits decided bits with
+ * a latency of at most 2*depth trellis steps. The history of the
+ * embedded decoder is used as a circular buffer of 2*depth entries.
+ */
+typedef struct
+{
+	viterbi_t vit;
+	const uint8_t* punct;	//puncture pattern, NULL if none
+	uint16_t p_len;			//puncture pattern length
+	uint16_t p;				//current puncture pattern entry
+	uint16_t depth;			//traceback depth in trellis steps
+	uint16_t head;			//next history entry to write
+	uint16_t fill;			//number of undecided trellis steps
+	uint16_t pend;			//first soft bit of an incomplete pair
+	uint8_t has_pend;		//is pend valid?
+	uint32_t erasures;		//number of depunctured bits so far
+	uint64_t norm;			//total cost removed by metric renormalization
+} viterbi_stream_t;
+
+/**
+ * @brief Soft-output Viterbi (SOVA) decoder context.
+ * Keeps the path metric difference of every decision for the
+ * reliability computation.
+ */
+typedef struct
+{
+	viterbi_t vit;
+	uint16_t delta[M17_VITERBI_HIST_LEN][M17_CONVOL_STATES];	//path metric differences, saturated
+	uint8_t state[M17_VITERBI_HIST_LEN+1];	//states of the best path
+} viterbi_sova_t;
+
 // M17 C library - high level functions - m17.c
 void gen_preamble(float out[SYM_PER_FRA], uint32_t* cnt, pream_t type);
 void gen_preamble_i8(int8_t out[SYM_PER_FRA], uint32_t* cnt, pream_t type);
@@ -101,14 +350,31 @@ void gen_syncword(float out[SYM_PER_SWD], uint32_t* cnt, uint16_t syncword);
 void gen_syncword_i8(int8_t out[SYM_PER_SWD], uint32_t* cnt, uint16_t syncword);
 void gen_data(float out[SYM_PER_PLD], uint32_t* cnt, const uint8_t* in);
 void gen_data_i8(int8_t out[SYM_PER_PLD], uint32_t* cnt, const uint8_t* in);
+void gen_data_packed(float out[SYM_PER_PLD], uint32_t* cnt, const uint8_t in[SYM_PER_PLD*2/8]);
+void gen_data_packed_i8(int8_t out[SYM_PER_PLD], uint32_t* cnt, const uint8_t in[SYM_PER_PLD*2/8]);
 void gen_eot(float out[SYM_PER_FRA], uint32_t* cnt);
 void gen_eot_i8(int8_t out[SYM_PER_FRA], uint32_t* cnt);
 void gen_frame(float out[SYM_PER_FRA], const uint8_t* data, frame_t type, const lsf_t* lsf, uint8_t lich_cnt, uint16_t fn);
 void gen_frame_i8(int8_t out[SYM_PER_FRA], const uint8_t* data, frame_t type, const lsf_t* lsf, uint8_t lich_cnt, uint16_t fn);
+void gen_frame_bits(uint8_t out[SYM_PER_PLD*2/8], const uint8_t* data, frame_t type, const lsf_t* lsf, uint8_t lich_cnt, uint16_t fn);
 
 uint32_t decode_LSF(lsf_t* lsf, const float pld_symbs[SYM_PER_PLD]);
 uint32_t decode_str_frame(uint8_t frame_data[16], uint8_t lich[5], uint16_t* fn, uint8_t* lich_cnt, const float pld_symbs[SYM_PER_PLD]);
 uint32_t decode_pkt_frame(uint8_t frame_data[25], uint8_t* eof, uint8_t* fn, const float pld_symbs[SYM_PER_PLD]);
+uint32_t decode_LSF_ctx(viterbi_t* ctx, lsf_t* lsf, const float pld_symbs[SYM_PER_PLD]);
+uint32_t decode_str_frame_ctx(viterbi_t* ctx, uint8_t frame_data[16], uint8_t lich[5], uint16_t* fn, uint8_t* lich_cnt, const float pld_symbs[SYM_PER_PLD]);
+uint32_t decode_str_frame_cached(viterbi_t* ctx, lich_cache_t* cache, uint8_t frame_data[16], uint8_t lich[5], uint16_t* fn, uint8_t* lich_cnt, const float pld_symbs[SYM_PER_PLD]);
+uint32_t decode_pkt_frame_ctx(viterbi_t* ctx, uint8_t frame_data[25], uint8_t* eof, uint8_t* fn, const float pld_symbs[SYM_PER_PLD]);
+uint32_t decode_LSF_llr(viterbi_t* ctx, lsf_t* lsf, const float pld_symbs[SYM_PER_PLD]);
+uint32_t decode_str_frame_llr(viterbi_t* ctx, uint8_t frame_data[16], uint8_t lich[5], uint16_t* fn, uint8_t* lich_cnt, const float pld_symbs[SYM_PER_PLD]);
+uint32_t decode_pkt_frame_llr(viterbi_t* ctx, uint8_t frame_data[25], uint8_t* eof, uint8_t* fn, const float pld_symbs[SYM_PER_PLD]);
+int8_t decode_LSF_batch(viterbi_batch_t* ctx, lsf_t lsf[], uint32_t e[], const float* const pld_symbs[], uint8_t n);
+int8_t decode_str_frame_batch(viterbi_batch_t* ctx, uint8_t frame_data[][16], uint8_t lich[][5], uint16_t fn[], uint8_t lich_cnt[],
+	uint32_t e[], const float* const pld_symbs[], uint8_t n);
+int8_t decode_pkt_frame_batch(viterbi_batch_t* ctx, uint8_t frame_data[][25], uint8_t eof[], uint8_t fn[],
+	uint32_t e[], const float* const pld_symbs[], uint8_t n);
+uint32_t decode_LSF_sova(viterbi_sova_t* ctx, lsf_t* lsf, uint16_t rel[240], const float pld_symbs[SYM_PER_PLD]);
+uint32_t decode_pkt_frame_sova(viterbi_sova_t* ctx, uint8_t frame_data[25], uint8_t* eof, uint8_t* fn, uint16_t rel[200], const float pld_symbs[SYM_PER_PLD]);
 
 // M17 C library - encode/convol.c
 extern const uint8_t puncture_pattern_1[61];
@@ -119,6 +385,12 @@ void conv_encode_stream_frame(uint8_t* out, const uint8_t* in, uint16_t fn);
 void conv_encode_packet_frame(uint8_t out[SYM_PER_PLD*2], const uint8_t in[26]);
 void conv_encode_LSF(uint8_t out[SYM_PER_PLD*2], const lsf_t* in);
 void conv_encode_bert_frame(uint8_t out[SYM_PER_PLD*2], const uint8_t in[25]);
+void conv_encode_packed(uint16_t* out, const uint8_t* in, uint16_t len);
+uint16_t conv_puncture_packed(uint8_t* out, const uint16_t* in, uint16_t len, const uint8_t* punct, uint16_t p_len, uint16_t max_len);
+void conv_encode_stream_frame_packed(uint8_t out[34], const uint8_t in[16], uint16_t fn);
+void conv_encode_packet_frame_packed(uint8_t out[SYM_PER_PLD*2/8], const uint8_t in[26]);
+void conv_encode_LSF_packed(uint8_t out[SYM_PER_PLD*2/8], const lsf_t* in);
+void conv_encode_bert_frame_packed(uint8_t out[SYM_PER_PLD*2/8], const uint8_t in[25]);
 
 // M17 C library - payload/call.c
 #define CHAR_MAP	" ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789-/."
@@ -133,8 +405,10 @@ int8_t encode_callsign_value(uint64_t *out, const char *inp);
 // M17 C library - payload/crc.c
 //M17 CRC polynomial
 extern const uint16_t M17_CRC_POLY;
+#define M17_CHASE_MAX_BITS			16		//max number of unreliable bits flipped by CRC_M17_chase()
 
 uint16_t CRC_M17(const uint8_t* in, uint16_t len);
+int32_t CRC_M17_chase(uint8_t* in, uint16_t len, const uint16_t* rel, uint16_t budget);
 uint16_t LSF_CRC(const lsf_t* in);
 
 // M17 C library - payload/lich.c
@@ -153,12 +427,23 @@ int8_t get_LSF_meta_position(uint8_t *data_source, uint8_t *station_type,
 	float *lat, float *lon, uint8_t *validity, float *altitude, uint16_t *bearing, float *speed, float *radius, const lsf_t *lsf);
 
 // M17 C library - math/golay.c
+#define M17_GOLAY_HARD_MARGIN	0x4000		//soft bits within this distance of 0x8000 are marginal and need the soft search
+
 extern const uint16_t encode_matrix[12];
 extern const uint16_t decode_matrix[12];
+extern const uint32_t golay_syndrome_table[4096];
 
 uint32_t golay24_encode(uint16_t data);
 uint16_t golay24_sdecode(const uint16_t codeword[24]);
+uint16_t golay24_sdecode_ml(const uint16_t codeword[24], uint32_t* margin);
+uint16_t golay24_sdecode_ct(const uint16_t codeword[24]);
 void decode_LICH(uint8_t outp[6], const uint16_t inp[96]);
+void decode_LICH_batch(uint8_t outp[][6], const uint16_t* inp, uint16_t stride, uint16_t n);
+void lich_cache_init(lich_cache_t* cache);
+void decode_LICH_cached(lich_cache_t* cache, uint8_t outp[6], const uint16_t inp[96]);
+uint32_t decode_LICH_ml(uint8_t outp[6], const uint16_t inp[96]);
+void decode_LICH_ct(uint8_t outp[6], const uint16_t inp[96]);
+void decode_LICH_llr(uint8_t outp[6], const int8_t inp[96]);
 void encode_LICH(uint8_t outp[12], const uint8_t inp[6]);
 
 // M17 C library - phy/interleave.c
@@ -167,18 +452,105 @@ extern const uint16_t intrl_seq[SYM_PER_PLD*2];
 
 void reorder_bits(uint8_t outp[SYM_PER_PLD*2], const uint8_t inp[SYM_PER_PLD*2]);
 void reorder_soft_bits(uint16_t outp[SYM_PER_PLD*2], const uint16_t inp[SYM_PER_PLD*2]);
+void reorder_packed(uint8_t outp[SYM_PER_PLD*2/8], const uint8_t inp[SYM_PER_PLD*2/8]);
+void reorder_llr(int8_t outp[SYM_PER_PLD*2], const int8_t inp[SYM_PER_PLD*2]);
 
 // M17 C library - math/math.c
-uint16_t q_abs_diff(uint16_t v1, uint16_t v2);
 float eucl_norm(const float* in1, const int8_t* in2, uint8_t n);
 float sq_eucl_norm(const float* in1, const int8_t* in2, uint8_t n);
 void int_to_soft(uint16_t* out, uint16_t in, uint8_t len);
 uint16_t soft_to_int(const uint16_t* in, uint8_t len);
 uint16_t div16(uint16_t a, uint16_t b);
-uint16_t mul16(uint16_t a, uint16_t b);
-uint16_t soft_bit_XOR(uint16_t a, uint16_t b);
-uint16_t soft_bit_NOT(uint16_t a);
 void soft_XOR(uint16_t* out, const uint16_t* a, const uint16_t* b, uint8_t len);
+void soft_NOT_masked(uint16_t* inp, const uint8_t* mask, uint16_t len);
+void llr_NEG_masked(int8_t* inp, const uint8_t* mask, uint16_t len);
+
+/**
+ * @brief Utility function returning the absolute value of a difference between
+ * two fixed-point values.
+ *
+ * @param v1 First value.
+ * @param v2 Second value.
+ * @return abs(v1-v2) value.
+ */
+inline uint16_t q_abs_diff(uint16_t v1, uint16_t v2)
+{
+	if(v2 > v1) return v2 - v1;
+	return v1 - v2;
+}
+
+/**
+ * @brief 1st quadrant fixed point addition with saturation.
+ *
+ * @param a Addend 1.
+ * @param b Addend 2.
+ * @return uint16_t Sum = a+b.
+ */
+inline uint16_t add16(uint16_t a, uint16_t b)
+{
+	uint32_t r=(uint32_t)a+b;
+
+	return r<=0xFFFFU ? r : 0xFFFFU;
+}
+
+/**
+ * @brief 1st quadrant fixed point subtraction with saturation.
+ *
+ * @param a Minuend.
+ * @param b Subtrahent.
+ * @return uint16_t Difference = a-b.
+ */
+inline uint16_t sub16(uint16_t a, uint16_t b)
+{
+	if(a>=b)
+		return a-b;
+	else
+		return 0x0000U;
+}
+
+/**
+ * @brief 1st quadrant fixed point multiplication.
+ *
+ * @param a Multiplicand.
+ * @param b Multiplier.
+ * @return uint16_t Product = a*b.
+ */
+inline uint16_t mul16(uint16_t a, uint16_t b)
+{
+	return (uint16_t)(((uint32_t)a*b)>>16);
+}
+
+/**
+ * @brief Bilinear interpolation (soft-valued expansion) for XOR.
+ * This approach retains XOR(0.5, 0.5)=0.5
+ * https://math.stackexchange.com/questions/3505934/evaluation-of-not-and-xor-in-fuzzy-logic-rules
+ * @param a Input A.
+ * @param b Input B.
+ * @return uint16_t Output = A xor B.
+ */
+inline uint16_t soft_bit_XOR(uint16_t a, uint16_t b)
+{
+	//a(1-b)+b(1-a)
+	return add16(mul16(a, sub16(0xFFFF, b)), mul16(b, sub16(0xFFFF, a)));
+}
+
+/**
+ * @brief Soft logic NOT.
+ *
+ * @param a Input A.
+ * @return uint16_t Output = not A.
+ */
+inline uint16_t soft_bit_NOT(uint16_t a)
+{
+	return 0xFFFFU-a;
+}
+
+//SIMD extensions detected at runtime
+#define M17_CPU_SSE2			(1<<0)
+#define M17_CPU_AVX2			(1<<1)
+#define M17_CPU_NEON			(1<<2)
+
+uint32_t m17_cpu_features(void);
 
 // M17 C library - phy/randomize.c
 //randomizing pattern
@@ -186,9 +558,31 @@ extern const uint8_t rand_seq[46];
 
 void randomize_bits(uint8_t inp[SYM_PER_PLD*2]);
 void randomize_soft_bits(uint16_t inp[SYM_PER_PLD*2]);
+void randomize_packed(uint8_t inp[SYM_PER_PLD*2/8]);
+void randomize_llr(int8_t inp[SYM_PER_PLD*2]);
 
 // M17 C library - phy/slice.c
 void slice_symbols(uint16_t out[2*SYM_PER_PLD], const float inp[SYM_PER_PLD]);
+void slice_symbols_fused(uint16_t out[2*SYM_PER_PLD], const float inp[SYM_PER_PLD]);
+void slice_symbols_llr(int8_t out[2*SYM_PER_PLD], const float inp[SYM_PER_PLD]);
+
+// M17 C library - phy/filter.c
+int8_t rrc_interp_init(rrc_interp_t* ctx, uint8_t sps);
+void rrc_interp_reset(rrc_interp_t* ctx);
+uint32_t rrc_interp(rrc_interp_t* ctx, float* out, const float* in, uint32_t len);
+uint32_t rrc_interp_i8(rrc_interp_t* ctx, float* out, const int8_t* in, uint32_t len);
+int8_t rrc_decim_init(rrc_decim_t* ctx, uint8_t sps, uint8_t phase);
+void rrc_decim_reset(rrc_decim_t* ctx);
+uint32_t rrc_decim(rrc_decim_t* ctx, float* out, const float* in, uint32_t len);
+int8_t symbol_sync_init(symbol_sync_t* ctx, uint8_t sps);
+void symbol_sync_reset(symbol_sync_t* ctx);
+uint32_t symbol_sync(symbol_sync_t* ctx, float* out, const float* in, uint32_t len);
+
+// M17 C library - decode/frame_sync.c
+void sync_detect_init(sync_detect_t* ctx, float thresh, sync_cb_t cb, void* user);
+void sync_detect_reset(sync_detect_t* ctx);
+int8_t sync_detect_set_tracking(sync_detect_t* ctx, uint8_t window, uint8_t max_misses);
+uint32_t sync_detect(sync_detect_t* ctx, const float* in, uint32_t len);
 
 // M17 C library - math/rrc.c
 //sample RRC filter for 48kHz sample rate
@@ -221,10 +615,26 @@ extern const uint16_t SYNC_BER;
 extern const uint16_t EOT_MRKR;
 
 // M17 C library - decode/viterbi.c
-#define M17_CONVOL_K				5									//constraint length K=5
-#define M17_CONVOL_STATES	        (1 << (M17_CONVOL_K - 1))			//number of states of the convolutional encoder
-#define M17_VITERBI_HIST_LEN		244
-#define M17_VITERBI_HIST_LEN_2		(2*M17_VITERBI_HIST_LEN)
+void viterbi_init(viterbi_t* ctx);
+uint32_t viterbi_decode_ctx(viterbi_t* ctx, uint8_t* out, const uint16_t* in, uint16_t len);
+uint32_t viterbi_decode_punctured_ctx(viterbi_t* ctx, uint8_t* out, const uint16_t* in, const uint8_t* punct, uint16_t in_len, uint16_t p_len);
+void viterbi_decode_bit_ctx(viterbi_t* ctx, uint16_t s0, uint16_t s1, size_t pos);
+uint32_t viterbi_chainback_ctx(viterbi_t* ctx, uint8_t* out, size_t pos, uint16_t len);
+void viterbi_reset_ctx(viterbi_t* ctx);
+int8_t viterbi_set_kernel(viterbi_t* ctx, viterbi_kernel_t kernel);
+int8_t viterbi_set_opts(viterbi_t* ctx, uint8_t opts, uint16_t hard_max_err);
+uint32_t viterbi_decode_punctured_hard_ctx(viterbi_t* ctx, uint8_t* out, const uint16_t* in, const uint8_t* punct, uint16_t in_len, uint16_t p_len);
+uint32_t viterbi_decode_punctured_llr(viterbi_t* ctx, uint8_t* out, const int8_t* in, const uint8_t* punct, uint16_t in_len, uint16_t p_len);
+uint32_t viterbi_decode_punctured_shortcut(uint8_t* out, const uint16_t* in, const uint8_t* punct, uint16_t in_len, uint16_t p_len);
+void viterbi_batch_init(viterbi_batch_t* ctx);
+int8_t viterbi_batch_set_kernel(viterbi_batch_t* ctx, viterbi_kernel_t kernel);
+int8_t viterbi_decode_punctured_batch(viterbi_batch_t* ctx, uint8_t* const out[], uint32_t cost[],
+	const uint16_t* const in[], const uint8_t* punct, uint16_t in_len, uint16_t p_len, uint8_t n);
+int8_t viterbi_stream_init(viterbi_stream_t* ctx, uint16_t depth, const uint8_t* punct, uint16_t p_len);
+uint16_t viterbi_stream_push(viterbi_stream_t* ctx, uint8_t* out, const uint16_t* in, uint16_t len);
+uint16_t viterbi_stream_flush(viterbi_stream_t* ctx, uint8_t* out, uint32_t* cost);
+void viterbi_sova_init(viterbi_sova_t* ctx);
+uint32_t viterbi_decode_punctured_sova(viterbi_sova_t* ctx, uint8_t* out, uint16_t* rel, const uint16_t* in, const uint8_t* punct, uint16_t in_len, uint16_t p_len);
 
 uint32_t viterbi_decode(uint8_t* out, const uint16_t* in, uint16_t len);
 uint32_t viterbi_decode_punctured(uint8_t* out, const uint16_t* in, const uint8_t* punct, uint16_t in_len, uint16_t p_len);
@@ -4,7 +4,10 @@
 // This file contains:
 // - Golay(24, 12) encoder
 // - Golay(24, 12) soft decoder with accompanying utility functions
-// - Link Information Channel (LICH) decoder
+// - Golay(24, 12) syndrome table for hard decisions
+// - Golay(24, 12) maximum likelihood soft decoder
+// - Golay(24, 12) constant-time soft decoder
+// - Link Information Channel (LICH) decoder, single, batched and cached
 //
 // Wojciech Kaczmarski, SP5WWP
 // M17 Project, 25 January 2026
@@ -12,6 +15,10 @@
 #include <string.h>
 #include "m17.h"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 /**
  * @brief Precomputed encoding matrix for Golay(24, 12).
  *
@@ -32,6 +39,528 @@ const uint16_t decode_matrix[12]=
     0xab9, 0x1ed, 0x3da, 0x7b4, 0xf68, 0xa4f
 };
 
+/**
+ * @brief Syndrome to error pattern table for Golay(24, 12).
+ * Index is the 12-bit syndrome (received parity XOR recomputed checksum),
+ * entry is the minimum weight error pattern (parity in bits 0..11, data in bits 12..23).
+ * 0xFFFFFFFF marks the syndromes of weight-4 error patterns, which can't be corrected uniquely.
+ */
+const uint32_t golay_syndrome_table[4096]=
+{
+    0x00000000, 0x00000001, 0x00000002, 0x00000003, 0x00000004, 0x00000005, 0x00000006, 0x00000007,
+    0x00000008, 0x00000009, 0x0000000A, 0x0000000B, 0x0000000C, 0x0000000D, 0x0000000E, 0xFFFFFFFF,
+    0x00000010, 0x00000011, 0x00000012, 0x00000013, 0x00000014, 0x00000015, 0x00000016, 0xFFFFFFFF,
+    0x00000018, 0x00000019, 0x0000001A, 0xFFFFFFFF, 0x0000001C, 0xFFFFFFFF, 0xFFFFFFFF, 0x00048040,
+    0x00000020, 0x00000021, 0x00000022, 0x00000023, 0x00000024, 0x00000025, 0x00000026, 0xFFFFFFFF,
+    0x00000028, 0x00000029, 0x0000002A, 0xFFFFFFFF, 0x0000002C, 0xFFFFFFFF, 0xFFFFFFFF, 0x00824000,
+    0x00000030, 0x00000031, 0x00000032, 0xFFFFFFFF, 0x00000034, 0xFFFFFFFF, 0xFFFFFFFF, 0x00301000,
+    0x00000038, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400600, 0xFFFFFFFF, 0x00090080, 0x00002900, 0xFFFFFFFF,
+    0x00000040, 0x00000041, 0x00000042, 0x00000043, 0x00000044, 0x00000045, 0x00000046, 0xFFFFFFFF,
+    0x00000048, 0x00000049, 0x0000004A, 0xFFFFFFFF, 0x0000004C, 0xFFFFFFFF, 0xFFFFFFFF, 0x00048010,
+    0x00000050, 0x00000051, 0x00000052, 0xFFFFFFFF, 0x00000054, 0xFFFFFFFF, 0xFFFFFFFF, 0x00048008,
+    0x00000058, 0xFFFFFFFF, 0xFFFFFFFF, 0x00048004, 0xFFFFFFFF, 0x00048002, 0x00048001, 0x00048000,
+    0x00000060, 0x00000061, 0x00000062, 0xFFFFFFFF, 0x00000064, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010300,
+    0x00000068, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001880, 0xFFFFFFFF, 0x00602000, 0x00180400, 0xFFFFFFFF,
+    0x00000070, 0xFFFFFFFF, 0xFFFFFFFF, 0x00086000, 0xFFFFFFFF, 0x00800C00, 0x00420080, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00120100, 0x00A10000, 0xFFFFFFFF, 0x00005200, 0xFFFFFFFF, 0xFFFFFFFF, 0x00048020,
+    0x00000080, 0x00000081, 0x00000082, 0x00000083, 0x00000084, 0x00000085, 0x00000086, 0xFFFFFFFF,
+    0x00000088, 0x00000089, 0x0000008A, 0xFFFFFFFF, 0x0000008C, 0xFFFFFFFF, 0xFFFFFFFF, 0x00500100,
+    0x00000090, 0x00000091, 0x00000092, 0xFFFFFFFF, 0x00000094, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004A00,
+    0x00000098, 0xFFFFFFFF, 0xFFFFFFFF, 0x00222000, 0xFFFFFFFF, 0x00090020, 0x00801400, 0xFFFFFFFF,
+    0x000000A0, 0x000000A1, 0x000000A2, 0xFFFFFFFF, 0x000000A4, 0xFFFFFFFF, 0xFFFFFFFF, 0x00042400,
+    0x000000A8, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001840, 0xFFFFFFFF, 0x00090010, 0x00208200, 0xFFFFFFFF,
+    0x000000B0, 0xFFFFFFFF, 0xFFFFFFFF, 0x00808100, 0xFFFFFFFF, 0x00090008, 0x00420040, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00090004, 0x00144000, 0xFFFFFFFF, 0x00090001, 0x00090000, 0xFFFFFFFF, 0x00090002,
+    0x000000C0, 0x000000C1, 0x000000C2, 0xFFFFFFFF, 0x000000C4, 0xFFFFFFFF, 0xFFFFFFFF, 0x00A80000,
+    0x000000C8, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001820, 0xFFFFFFFF, 0x00020600, 0x00016000, 0xFFFFFFFF,
+    0x000000D0, 0xFFFFFFFF, 0xFFFFFFFF, 0x00110400, 0xFFFFFFFF, 0x00003100, 0x00420020, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00C04000, 0x00080300, 0xFFFFFFFF, 0x00300800, 0xFFFFFFFF, 0xFFFFFFFF, 0x00048080,
+    0x000000E0, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001808, 0xFFFFFFFF, 0x0010C000, 0x00420010, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00001802, 0x00001801, 0x00001800, 0x00840100, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001804,
+    0xFFFFFFFF, 0x00240200, 0x00420004, 0xFFFFFFFF, 0x00420002, 0xFFFFFFFF, 0x00420000, 0x00420001,
+    0x0000A400, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001810, 0xFFFFFFFF, 0x00090040, 0x00420008, 0xFFFFFFFF,
+    0x00000100, 0x00000101, 0x00000102, 0x00000103, 0x00000104, 0x00000105, 0x00000106, 0xFFFFFFFF,
+    0x00000108, 0x00000109, 0x0000010A, 0xFFFFFFFF, 0x0000010C, 0xFFFFFFFF, 0xFFFFFFFF, 0x00500080,
+    0x00000110, 0x00000111, 0x00000112, 0xFFFFFFFF, 0x00000114, 0xFFFFFFFF, 0xFFFFFFFF, 0x000A0400,
+    0x00000118, 0xFFFFFFFF, 0xFFFFFFFF, 0x00015000, 0xFFFFFFFF, 0x00A00200, 0x00002820, 0xFFFFFFFF,
+    0x00000120, 0x00000121, 0x00000122, 0xFFFFFFFF, 0x00000124, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010240,
+    0x00000128, 0xFFFFFFFF, 0xFFFFFFFF, 0x002C0000, 0xFFFFFFFF, 0x00009400, 0x00002810, 0xFFFFFFFF,
+    0x00000130, 0xFFFFFFFF, 0xFFFFFFFF, 0x00808080, 0xFFFFFFFF, 0x00444000, 0x00002808, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00120040, 0x00002804, 0xFFFFFFFF, 0x00002802, 0xFFFFFFFF, 0x00002800, 0x00002801,
+    0x00000140, 0x00000141, 0x00000142, 0xFFFFFFFF, 0x00000144, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010220,
+    0x00000148, 0xFFFFFFFF, 0xFFFFFFFF, 0x00802400, 0xFFFFFFFF, 0x00084800, 0x00221000, 0xFFFFFFFF,
+    0x00000150, 0xFFFFFFFF, 0xFFFFFFFF, 0x00600800, 0xFFFFFFFF, 0x00003080, 0x00904000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00120020, 0x00080280, 0xFFFFFFFF, 0x00410400, 0xFFFFFFFF, 0xFFFFFFFF, 0x00048100,
+    0x00000160, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010204, 0xFFFFFFFF, 0x00010202, 0x00010201, 0x00010200,
+    0xFFFFFFFF, 0x00120010, 0x0040C000, 0xFFFFFFFF, 0x00840080, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010208,
+    0xFFFFFFFF, 0x00120008, 0x00041400, 0xFFFFFFFF, 0x00288000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010210,
+    0x00120001, 0x00120000, 0xFFFFFFFF, 0x00120002, 0xFFFFFFFF, 0x00120004, 0x00002840, 0xFFFFFFFF,
+    0x00000180, 0x00000181, 0x00000182, 0xFFFFFFFF, 0x00000184, 0xFFFFFFFF, 0xFFFFFFFF, 0x00500008,
+    0x00000188, 0xFFFFFFFF, 0xFFFFFFFF, 0x00500004, 0xFFFFFFFF, 0x00500002, 0x00500001, 0x00500000,
+    0x00000190, 0xFFFFFFFF, 0xFFFFFFFF, 0x00808020, 0xFFFFFFFF, 0x00003040, 0x00250000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00040C00, 0x00080240, 0xFFFFFFFF, 0x0002C000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00500010,
+    0x000001A0, 0xFFFFFFFF, 0xFFFFFFFF, 0x00808010, 0xFFFFFFFF, 0x00220800, 0x00085000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00006200, 0x00030400, 0xFFFFFFFF, 0x00840040, 0xFFFFFFFF, 0xFFFFFFFF, 0x00500020,
+    0xFFFFFFFF, 0x00808002, 0x00808001, 0x00808000, 0x00100600, 0xFFFFFFFF, 0xFFFFFFFF, 0x00808004,
+    0x00601000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00808008, 0xFFFFFFFF, 0x00090100, 0x00002880, 0xFFFFFFFF,
+    0x000001C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x00064000, 0xFFFFFFFF, 0x00003010, 0x00008C00, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00218000, 0x00080210, 0xFFFFFFFF, 0x00840020, 0xFFFFFFFF, 0xFFFFFFFF, 0x00500040,
+    0xFFFFFFFF, 0x00003004, 0x00080208, 0xFFFFFFFF, 0x00003001, 0x00003000, 0xFFFFFFFF, 0x00003002,
+    0x00080202, 0xFFFFFFFF, 0x00080200, 0x00080201, 0xFFFFFFFF, 0x00003008, 0x00080204, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00480400, 0x00302000, 0xFFFFFFFF, 0x00840008, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010280,
+    0x00840004, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001900, 0x00840000, 0x00840001, 0x00840002, 0xFFFFFFFF,
+    0x00014800, 0xFFFFFFFF, 0xFFFFFFFF, 0x00808040, 0xFFFFFFFF, 0x00003020, 0x00420100, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00120080, 0x00080220, 0xFFFFFFFF, 0x00840010, 0xFFFFFFFF, 0xFFFFFFFF, 0x00204400,
+    0x00000200, 0x00000201, 0x00000202, 0x00000203, 0x00000204, 0x00000205, 0x00000206, 0xFFFFFFFF,
+    0x00000208, 0x00000209, 0x0000020A, 0xFFFFFFFF, 0x0000020C, 0xFFFFFFFF, 0xFFFFFFFF, 0x00083000,
+    0x00000210, 0x00000211, 0x00000212, 0xFFFFFFFF, 0x00000214, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004880,
+    0x00000218, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400420, 0xFFFFFFFF, 0x00A00100, 0x00130000, 0xFFFFFFFF,
+    0x00000220, 0x00000221, 0x00000222, 0xFFFFFFFF, 0x00000224, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010140,
+    0x00000228, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400410, 0xFFFFFFFF, 0x00140800, 0x00208080, 0xFFFFFFFF,
+    0x00000230, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400408, 0xFFFFFFFF, 0x0002A000, 0x008C0000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00400402, 0x00400401, 0x00400400, 0x00005040, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400404,
+    0x00000240, 0x00000241, 0x00000242, 0xFFFFFFFF, 0x00000244, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010120,
+    0x00000248, 0xFFFFFFFF, 0xFFFFFFFF, 0x00304000, 0xFFFFFFFF, 0x00020480, 0x00C00800, 0xFFFFFFFF,
+    0x00000250, 0xFFFFFFFF, 0xFFFFFFFF, 0x00821000, 0xFFFFFFFF, 0x00580000, 0x00202400, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00012800, 0x00080180, 0xFFFFFFFF, 0x00005020, 0xFFFFFFFF, 0xFFFFFFFF, 0x00048200,
+    0x00000260, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010104, 0xFFFFFFFF, 0x00010102, 0x00010101, 0x00010100,
+    0xFFFFFFFF, 0x00888000, 0x00062000, 0xFFFFFFFF, 0x00005010, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010108,
+    0xFFFFFFFF, 0x00240080, 0x00108800, 0xFFFFFFFF, 0x00005008, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010110,
+    0x00005004, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400440, 0x00005000, 0x00005001, 0x00005002, 0xFFFFFFFF,
+    0x00000280, 0x00000281, 0x00000282, 0xFFFFFFFF, 0x00000284, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004810,
+    0x00000288, 0xFFFFFFFF, 0xFFFFFFFF, 0x00850000, 0xFFFFFFFF, 0x00020440, 0x00208020, 0xFFFFFFFF,
+    0x00000290, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004804, 0xFFFFFFFF, 0x00004802, 0x00004801, 0x00004800,
+    0xFFFFFFFF, 0x00109000, 0x00080140, 0xFFFFFFFF, 0x00442000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004808,
+    0x000002A0, 0xFFFFFFFF, 0xFFFFFFFF, 0x001A0000, 0xFFFFFFFF, 0x00C01000, 0x00208008, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00006100, 0x00208004, 0xFFFFFFFF, 0x00208002, 0xFFFFFFFF, 0x00208000, 0x00208001,
+    0xFFFFFFFF, 0x00240040, 0x00013000, 0xFFFFFFFF, 0x00100500, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004820,
+    0x00820800, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400480, 0xFFFFFFFF, 0x00090200, 0x00208010, 0xFFFFFFFF,
+    0x000002C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x0040A000, 0xFFFFFFFF, 0x00020408, 0x00141000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00020404, 0x00080110, 0xFFFFFFFF, 0x00020401, 0x00020400, 0xFFFFFFFF, 0x00020402,
+    0xFFFFFFFF, 0x00240020, 0x00080108, 0xFFFFFFFF, 0x00818000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004840,
+    0x00080102, 0xFFFFFFFF, 0x00080100, 0x00080101, 0xFFFFFFFF, 0x00020410, 0x00080104, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00240010, 0x00804400, 0xFFFFFFFF, 0x00082800, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010180,
+    0x00510000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001A00, 0xFFFFFFFF, 0x00020420, 0x00208040, 0xFFFFFFFF,
+    0x00240001, 0x00240000, 0xFFFFFFFF, 0x00240002, 0xFFFFFFFF, 0x00240004, 0x00420200, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00240008, 0x00080120, 0xFFFFFFFF, 0x00005080, 0xFFFFFFFF, 0xFFFFFFFF, 0x00902000,
+    0x00000300, 0x00000301, 0x00000302, 0xFFFFFFFF, 0x00000304, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010060,
+    0x00000308, 0xFFFFFFFF, 0xFFFFFFFF, 0x00028800, 0xFFFFFFFF, 0x00A00010, 0x00044400, 0xFFFFFFFF,
+    0x00000310, 0xFFFFFFFF, 0xFFFFFFFF, 0x00142000, 0xFFFFFFFF, 0x00A00008, 0x00409000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00A00004, 0x000800C0, 0xFFFFFFFF, 0x00A00001, 0x00A00000, 0xFFFFFFFF, 0x00A00002,
+    0x00000320, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010044, 0xFFFFFFFF, 0x00010042, 0x00010041, 0x00010040,
+    0xFFFFFFFF, 0x00006080, 0x00901000, 0xFFFFFFFF, 0x004A0000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010048,
+    0xFFFFFFFF, 0x00081800, 0x00224000, 0xFFFFFFFF, 0x00100480, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010050,
+    0x00058000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400500, 0xFFFFFFFF, 0x00A00020, 0x00002A00, 0xFFFFFFFF,
+    0x00000340, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010024, 0xFFFFFFFF, 0x00010022, 0x00010021, 0x00010020,
+    0xFFFFFFFF, 0x00441000, 0x00080090, 0xFFFFFFFF, 0x0010A000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010028,
+    0xFFFFFFFF, 0x0000C400, 0x00080088, 0xFFFFFFFF, 0x00060800, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010030,
+    0x00080082, 0xFFFFFFFF, 0x00080080, 0x00080081, 0xFFFFFFFF, 0x00A00040, 0x00080084, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00010006, 0x00010005, 0x00010004, 0x00010003, 0x00010002, 0x00010001, 0x00010000,
+    0x00200C00, 0xFFFFFFFF, 0xFFFFFFFF, 0x0001000C, 0xFFFFFFFF, 0x0001000A, 0x00010009, 0x00010008,
+    0x00C02000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010014, 0xFFFFFFFF, 0x00010012, 0x00010011, 0x00010010,
+    0xFFFFFFFF, 0x00120200, 0x000800A0, 0xFFFFFFFF, 0x00005100, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010018,
+    0x00000380, 0xFFFFFFFF, 0xFFFFFFFF, 0x00201400, 0xFFFFFFFF, 0x000C8000, 0x00822000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00006020, 0x00080050, 0xFFFFFFFF, 0x00011800, 0xFFFFFFFF, 0xFFFFFFFF, 0x00500200,
+    0xFFFFFFFF, 0x00430000, 0x00080048, 0xFFFFFFFF, 0x00100420, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004900,
+    0x00080042, 0xFFFFFFFF, 0x00080040, 0x00080041, 0xFFFFFFFF, 0x00A00080, 0x00080044, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00006008, 0x00440800, 0xFFFFFFFF, 0x00100410, 0xFFFFFFFF, 0xFFFFFFFF, 0x000100C0,
+    0x00006001, 0x00006000, 0xFFFFFFFF, 0x00006002, 0xFFFFFFFF, 0x00006004, 0x00208100, 0xFFFFFFFF,
+    0x00100404, 0xFFFFFFFF, 0xFFFFFFFF, 0x00808200, 0x00100400, 0x00100401, 0x00100402, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00006010, 0x00080060, 0xFFFFFFFF, 0x00100408, 0xFFFFFFFF, 0xFFFFFFFF, 0x00061000,
+    0xFFFFFFFF, 0x00900800, 0x00080018, 0xFFFFFFFF, 0x00604000, 0xFFFFFFFF, 0xFFFFFFFF, 0x000100A0,
+    0x00080012, 0xFFFFFFFF, 0x00080010, 0x00080011, 0xFFFFFFFF, 0x00020500, 0x00080014, 0xFFFFFFFF,
+    0x0008000A, 0xFFFFFFFF, 0x00080008, 0x00080009, 0xFFFFFFFF, 0x00003200, 0x0008000C, 0xFFFFFFFF,
+    0x00080002, 0x00080003, 0x00080000, 0x00080001, 0x00080006, 0xFFFFFFFF, 0x00080004, 0x00080005,
+    0x00029000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010084, 0xFFFFFFFF, 0x00010082, 0x00010081, 0x00010080,
+    0xFFFFFFFF, 0x00006040, 0x00080030, 0xFFFFFFFF, 0x00840200, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010088,
+    0xFFFFFFFF, 0x00240100, 0x00080028, 0xFFFFFFFF, 0x00100440, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010090,
+    0x00080022, 0xFFFFFFFF, 0x00080020, 0x00080021, 0xFFFFFFFF, 0x00408800, 0x00080024, 0xFFFFFFFF,
+    0x00000400, 0x00000401, 0x00000402, 0x00000403, 0x00000404, 0x00000405, 0x00000406, 0xFFFFFFFF,
+    0x00000408, 0x00000409, 0x0000040A, 0xFFFFFFFF, 0x0000040C, 0xFFFFFFFF, 0xFFFFFFFF, 0x00210800,
+    0x00000410, 0x00000411, 0x00000412, 0xFFFFFFFF, 0x00000414, 0xFFFFFFFF, 0xFFFFFFFF, 0x000A0100,
+    0x00000418, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400220, 0xFFFFFFFF, 0x00106000, 0x00801080, 0xFFFFFFFF,
+    0x00000420, 0x00000421, 0x00000422, 0xFFFFFFFF, 0x00000424, 0xFFFFFFFF, 0xFFFFFFFF, 0x00042080,
+    0x00000428, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400210, 0xFFFFFFFF, 0x00009100, 0x00180040, 0xFFFFFFFF,
+    0x00000430, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400208, 0xFFFFFFFF, 0x00800840, 0x0001C000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00400202, 0x00400201, 0x00400200, 0x00260000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400204,
+    0x00000440, 0x00000441, 0x00000442, 0xFFFFFFFF, 0x00000444, 0xFFFFFFFF, 0xFFFFFFFF, 0x00405000,
+    0x00000448, 0xFFFFFFFF, 0xFFFFFFFF, 0x00802100, 0xFFFFFFFF, 0x00020280, 0x00180020, 0xFFFFFFFF,
+    0x00000450, 0xFFFFFFFF, 0xFFFFFFFF, 0x00110080, 0xFFFFFFFF, 0x00800820, 0x00202200, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00281000, 0x00024800, 0xFFFFFFFF, 0x00410100, 0xFFFFFFFF, 0xFFFFFFFF, 0x00048400,
+    0x00000460, 0xFFFFFFFF, 0xFFFFFFFF, 0x00228000, 0xFFFFFFFF, 0x00800810, 0x00180008, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00054000, 0x00180004, 0xFFFFFFFF, 0x00180002, 0xFFFFFFFF, 0x00180000, 0x00180001,
+    0xFFFFFFFF, 0x00800804, 0x00041100, 0xFFFFFFFF, 0x00800801, 0x00800800, 0xFFFFFFFF, 0x00800802,
+    0x0000A080, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400240, 0xFFFFFFFF, 0x00800808, 0x00180010, 0xFFFFFFFF,
+    0x00000480, 0x00000481, 0x00000482, 0xFFFFFFFF, 0x00000484, 0xFFFFFFFF, 0xFFFFFFFF, 0x00042020,
+    0x00000488, 0xFFFFFFFF, 0xFFFFFFFF, 0x0008C000, 0xFFFFFFFF, 0x00020240, 0x00801010, 0xFFFFFFFF,
+    0x00000490, 0xFFFFFFFF, 0xFFFFFFFF, 0x00110040, 0xFFFFFFFF, 0x00608000, 0x00801008, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00040900, 0x00801004, 0xFFFFFFFF, 0x00801002, 0xFFFFFFFF, 0x00801000, 0x00801001,
+    0x000004A0, 0xFFFFFFFF, 0xFFFFFFFF, 0x00042004, 0xFFFFFFFF, 0x00042002, 0x00042001, 0x00042000,
+    0xFFFFFFFF, 0x00B00000, 0x00030100, 0xFFFFFFFF, 0x00404800, 0xFFFFFFFF, 0xFFFFFFFF, 0x00042008,
+    0xFFFFFFFF, 0x00025000, 0x00280800, 0xFFFFFFFF, 0x00100300, 0xFFFFFFFF, 0xFFFFFFFF, 0x00042010,
+    0x0000A040, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400280, 0xFFFFFFFF, 0x00090400, 0x00801020, 0xFFFFFFFF,
+    0x000004C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x00110010, 0xFFFFFFFF, 0x00020208, 0x00008900, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00020204, 0x00640000, 0xFFFFFFFF, 0x00020201, 0x00020200, 0xFFFFFFFF, 0x00020202,
+    0xFFFFFFFF, 0x00110002, 0x00110001, 0x00110000, 0x000C4000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00110004,
+    0x0000A020, 0xFFFFFFFF, 0xFFFFFFFF, 0x00110008, 0xFFFFFFFF, 0x00020210, 0x00801040, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00480100, 0x00804200, 0xFFFFFFFF, 0x00211000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00042040,
+    0x0000A010, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001C00, 0xFFFFFFFF, 0x00020220, 0x00180080, 0xFFFFFFFF,
+    0x0000A008, 0xFFFFFFFF, 0xFFFFFFFF, 0x00110020, 0xFFFFFFFF, 0x00800880, 0x00420400, 0xFFFFFFFF,
+    0x0000A000, 0x0000A001, 0x0000A002, 0xFFFFFFFF, 0x0000A004, 0xFFFFFFFF, 0xFFFFFFFF, 0x00204100,
+    0x00000500, 0x00000501, 0x00000502, 0xFFFFFFFF, 0x00000504, 0xFFFFFFFF, 0xFFFFFFFF, 0x000A0010,
+    0x00000508, 0xFFFFFFFF, 0xFFFFFFFF, 0x00802040, 0xFFFFFFFF, 0x00009020, 0x00044200, 0xFFFFFFFF,
+    0x00000510, 0xFFFFFFFF, 0xFFFFFFFF, 0x000A0004, 0xFFFFFFFF, 0x000A0002, 0x000A0001, 0x000A0000,
+    0xFFFFFFFF, 0x00040880, 0x00308000, 0xFFFFFFFF, 0x00410040, 0xFFFFFFFF, 0xFFFFFFFF, 0x000A0008,
+    0x00000520, 0xFFFFFFFF, 0xFFFFFFFF, 0x00104800, 0xFFFFFFFF, 0x00009008, 0x00E00000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00009004, 0x00030080, 0xFFFFFFFF, 0x00009001, 0x00009000, 0xFFFFFFFF, 0x00009002,
+    0xFFFFFFFF, 0x00212000, 0x00041040, 0xFFFFFFFF, 0x00100280, 0xFFFFFFFF, 0xFFFFFFFF, 0x000A0020,
+    0x00884000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400300, 0xFFFFFFFF, 0x00009010, 0x00002C00, 0xFFFFFFFF,
+    0x00000540, 0xFFFFFFFF, 0xFFFFFFFF, 0x00802008, 0xFFFFFFFF, 0x00340000, 0x00008880, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00802002, 0x00802001, 0x00802000, 0x00410010, 0xFFFFFFFF, 0xFFFFFFFF, 0x00802004,
+    0xFFFFFFFF, 0x0000C200, 0x00041020, 0xFFFFFFFF, 0x00410008, 0xFFFFFFFF, 0xFFFFFFFF, 0x000A0040,
+    0x00410004, 0xFFFFFFFF, 0xFFFFFFFF, 0x00802010, 0x00410000, 0x00410001, 0x00410002, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00480080, 0x00041010, 0xFFFFFFFF, 0x00026000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010600,
+    0x00200A00, 0xFFFFFFFF, 0xFFFFFFFF, 0x00802020, 0xFFFFFFFF, 0x00009040, 0x00180100, 0xFFFFFFFF,
+    0x00041002, 0xFFFFFFFF, 0x00041000, 0x00041001, 0xFFFFFFFF, 0x00800900, 0x00041004, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00120400, 0x00041008, 0xFFFFFFFF, 0x00410020, 0xFFFFFFFF, 0xFFFFFFFF, 0x00204080,
+    0x00000580, 0xFFFFFFFF, 0xFFFFFFFF, 0x00201200, 0xFFFFFFFF, 0x00814000, 0x00008840, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00040810, 0x00030020, 0xFFFFFFFF, 0x00282000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00500400,
+    0xFFFFFFFF, 0x00040808, 0x00406000, 0xFFFFFFFF, 0x00100220, 0xFFFFFFFF, 0xFFFFFFFF, 0x000A0080,
+    0x00040801, 0x00040800, 0xFFFFFFFF, 0x00040802, 0xFFFFFFFF, 0x00040804, 0x00801100, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00480040, 0x00030008, 0xFFFFFFFF, 0x00100210, 0xFFFFFFFF, 0xFFFFFFFF, 0x00042100,
+    0x00030002, 0xFFFFFFFF, 0x00030000, 0x00030001, 0xFFFFFFFF, 0x00009080, 0x00030004, 0xFFFFFFFF,
+    0x00100204, 0xFFFFFFFF, 0xFFFFFFFF, 0x00808400, 0x00100200, 0x00100201, 0x00100202, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00040820, 0x00030010, 0xFFFFFFFF, 0x00100208, 0xFFFFFFFF, 0xFFFFFFFF, 0x00204040,
+    0xFFFFFFFF, 0x00480020, 0x00008804, 0xFFFFFFFF, 0x00008802, 0xFFFFFFFF, 0x00008800, 0x00008801,
+    0x00105000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00802080, 0xFFFFFFFF, 0x00020300, 0x00008808, 0xFFFFFFFF,
+    0x00A20000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00110100, 0xFFFFFFFF, 0x00003400, 0x00008810, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00040840, 0x00080600, 0xFFFFFFFF, 0x00410080, 0xFFFFFFFF, 0xFFFFFFFF, 0x00204020,
+    0x00480001, 0x00480000, 0xFFFFFFFF, 0x00480002, 0xFFFFFFFF, 0x00480004, 0x00008820, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00480008, 0x00030040, 0xFFFFFFFF, 0x00840400, 0xFFFFFFFF, 0xFFFFFFFF, 0x00204010,
+    0xFFFFFFFF, 0x00480010, 0x00041080, 0xFFFFFFFF, 0x00100240, 0xFFFFFFFF, 0xFFFFFFFF, 0x00204008,
+    0x0000A100, 0xFFFFFFFF, 0xFFFFFFFF, 0x00204004, 0xFFFFFFFF, 0x00204002, 0x00204001, 0x00204000,
+    0x00000600, 0x00000601, 0x00000602, 0xFFFFFFFF, 0x00000604, 0xFFFFFFFF, 0xFFFFFFFF, 0x00908000,
+    0x00000608, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400030, 0xFFFFFFFF, 0x000200C0, 0x00044100, 0xFFFFFFFF,
+    0x00000610, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400028, 0xFFFFFFFF, 0x00051000, 0x00202040, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00400022, 0x00400021, 0x00400020, 0x00088800, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400024,
+    0x00000620, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400018, 0xFFFFFFFF, 0x00284000, 0x00021800, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00400012, 0x00400011, 0x00400010, 0x00812000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400014,
+    0xFFFFFFFF, 0x0040000A, 0x00400009, 0x00400008, 0x00100180, 0xFFFFFFFF, 0xFFFFFFFF, 0x0040000C,
+    0x00400003, 0x00400002, 0x00400001, 0x00400000, 0xFFFFFFFF, 0x00400006, 0x00400005, 0x00400004,
+    0x00000640, 0xFFFFFFFF, 0xFFFFFFFF, 0x000C0800, 0xFFFFFFFF, 0x00020088, 0x00202010, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00020084, 0x00019000, 0xFFFFFFFF, 0x00020081, 0x00020080, 0xFFFFFFFF, 0x00020082,
+    0xFFFFFFFF, 0x0000C100, 0x00202004, 0xFFFFFFFF, 0x00202002, 0xFFFFFFFF, 0x00202000, 0x00202001,
+    0x00940000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400060, 0xFFFFFFFF, 0x00020090, 0x00202008, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00103000, 0x00804080, 0xFFFFFFFF, 0x00448000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010500,
+    0x00200900, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400050, 0xFFFFFFFF, 0x000200A0, 0x00180200, 0xFFFFFFFF,
+    0x000B0000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400048, 0xFFFFFFFF, 0x00800A00, 0x00202020, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00400042, 0x00400041, 0x00400040, 0x00005400, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400044,
+    0x00000680, 0xFFFFFFFF, 0xFFFFFFFF, 0x00201100, 0xFFFFFFFF, 0x00020048, 0x00490000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00020044, 0x00102800, 0xFFFFFFFF, 0x00020041, 0x00020040, 0xFFFFFFFF, 0x00020042,
+    0xFFFFFFFF, 0x00882000, 0x00068000, 0xFFFFFFFF, 0x00100120, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004C00,
+    0x00214000, 0xFFFFFFFF, 0xFFFFFFFF, 0x004000A0, 0xFFFFFFFF, 0x00020050, 0x00801200, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00018800, 0x00804040, 0xFFFFFFFF, 0x00100110, 0xFFFFFFFF, 0xFFFFFFFF, 0x00042200,
+    0x000C1000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400090, 0xFFFFFFFF, 0x00020060, 0x00208400, 0xFFFFFFFF,
+    0x00100104, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400088, 0x00100100, 0x00100101, 0x00100102, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00400082, 0x00400081, 0x00400080, 0x00100108, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400084,
+    0xFFFFFFFF, 0x0002000C, 0x00804020, 0xFFFFFFFF, 0x00020009, 0x00020008, 0xFFFFFFFF, 0x0002000A,
+    0x00020005, 0x00020004, 0xFFFFFFFF, 0x00020006, 0x00020001, 0x00020000, 0x00020003, 0x00020002,
+    0x00401800, 0xFFFFFFFF, 0xFFFFFFFF, 0x00110200, 0xFFFFFFFF, 0x00020018, 0x00202080, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00020014, 0x00080500, 0xFFFFFFFF, 0x00020011, 0x00020010, 0xFFFFFFFF, 0x00020012,
+    0x00804002, 0xFFFFFFFF, 0x00804000, 0x00804001, 0xFFFFFFFF, 0x00020028, 0x00804004, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00020024, 0x00804008, 0xFFFFFFFF, 0x00020021, 0x00020020, 0xFFFFFFFF, 0x00020022,
+    0xFFFFFFFF, 0x00240400, 0x00804010, 0xFFFFFFFF, 0x00100140, 0xFFFFFFFF, 0xFFFFFFFF, 0x00089000,
+    0x0000A200, 0xFFFFFFFF, 0xFFFFFFFF, 0x004000C0, 0xFFFFFFFF, 0x00020030, 0x00050800, 0xFFFFFFFF,
+    0x00000700, 0xFFFFFFFF, 0xFFFFFFFF, 0x00201080, 0xFFFFFFFF, 0x00402800, 0x00044008, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00190000, 0x00044004, 0xFFFFFFFF, 0x00044002, 0xFFFFFFFF, 0x00044000, 0x00044001,
+    0xFFFFFFFF, 0x0000C040, 0x00810800, 0xFFFFFFFF, 0x001000A0, 0xFFFFFFFF, 0xFFFFFFFF, 0x000A0200,
+    0x00023000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400120, 0xFFFFFFFF, 0x00A00400, 0x00044010, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00860000, 0x0008A000, 0xFFFFFFFF, 0x00100090, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010440,
+    0x00200840, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400110, 0xFFFFFFFF, 0x00009200, 0x00044020, 0xFFFFFFFF,
+    0x00100084, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400108, 0x00100080, 0x00100081, 0x00100082, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00400102, 0x00400101, 0x00400100, 0x00100088, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400104,
+    0xFFFFFFFF, 0x0000C010, 0x00520000, 0xFFFFFFFF, 0x00881000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010420,
+    0x00200820, 0xFFFFFFFF, 0xFFFFFFFF, 0x00802200, 0xFFFFFFFF, 0x00020180, 0x00044040, 0xFFFFFFFF,
+    0x0000C001, 0x0000C000, 0xFFFFFFFF, 0x0000C002, 0xFFFFFFFF, 0x0000C004, 0x00202100, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x0000C008, 0x00080480, 0xFFFFFFFF, 0x00410200, 0xFFFFFFFF, 0xFFFFFFFF, 0x00101800,
+    0x00200808, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010404, 0xFFFFFFFF, 0x00010402, 0x00010401, 0x00010400,
+    0x00200800, 0x00200801, 0x00200802, 0xFFFFFFFF, 0x00200804, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010408,
+    0xFFFFFFFF, 0x0000C020, 0x00041200, 0xFFFFFFFF, 0x001000C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010410,
+    0x00200810, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400140, 0xFFFFFFFF, 0x000C2000, 0x00828000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00201002, 0x00201001, 0x00201000, 0x00100030, 0xFFFFFFFF, 0xFFFFFFFF, 0x00201004,
+    0x00C08000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00201008, 0xFFFFFFFF, 0x00020140, 0x00044080, 0xFFFFFFFF,
+    0x00100024, 0xFFFFFFFF, 0xFFFFFFFF, 0x00201010, 0x00100020, 0x00100021, 0x00100022, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00040A00, 0x00080440, 0xFFFFFFFF, 0x00100028, 0xFFFFFFFF, 0xFFFFFFFF, 0x0001A000,
+    0x00100014, 0xFFFFFFFF, 0xFFFFFFFF, 0x00201020, 0x00100010, 0x00100011, 0x00100012, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00006400, 0x00030200, 0xFFFFFFFF, 0x00100018, 0xFFFFFFFF, 0xFFFFFFFF, 0x00880800,
+    0x00100004, 0x00100005, 0x00100006, 0xFFFFFFFF, 0x00100000, 0x00100001, 0x00100002, 0x00100003,
+    0x0010000C, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400180, 0x00100008, 0x00100009, 0x0010000A, 0xFFFFFFFF,
+    0x00052000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00201040, 0xFFFFFFFF, 0x00020108, 0x00008A00, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00020104, 0x00080410, 0xFFFFFFFF, 0x00020101, 0x00020100, 0xFFFFFFFF, 0x00020102,
+    0xFFFFFFFF, 0x0000C080, 0x00080408, 0xFFFFFFFF, 0x00100060, 0xFFFFFFFF, 0xFFFFFFFF, 0x00C40000,
+    0x00080402, 0xFFFFFFFF, 0x00080400, 0x00080401, 0xFFFFFFFF, 0x00020110, 0x00080404, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00480200, 0x00804100, 0xFFFFFFFF, 0x00100050, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010480,
+    0x00200880, 0xFFFFFFFF, 0xFFFFFFFF, 0x00148000, 0xFFFFFFFF, 0x00020120, 0x00403000, 0xFFFFFFFF,
+    0x00100044, 0xFFFFFFFF, 0xFFFFFFFF, 0x00022800, 0x00100040, 0x00100041, 0x00100042, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00811000, 0x00080420, 0xFFFFFFFF, 0x00100048, 0xFFFFFFFF, 0xFFFFFFFF, 0x00204200,
+    0x00000800, 0x00000801, 0x00000802, 0x00000803, 0x00000804, 0x00000805, 0x00000806, 0xFFFFFFFF,
+    0x00000808, 0x00000809, 0x0000080A, 0xFFFFFFFF, 0x0000080C, 0xFFFFFFFF, 0xFFFFFFFF, 0x00210400,
+    0x00000810, 0x00000811, 0x00000812, 0xFFFFFFFF, 0x00000814, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004280,
+    0x00000818, 0xFFFFFFFF, 0xFFFFFFFF, 0x00980000, 0xFFFFFFFF, 0x00421000, 0x00002120, 0xFFFFFFFF,
+    0x00000820, 0x00000821, 0x00000822, 0xFFFFFFFF, 0x00000824, 0xFFFFFFFF, 0xFFFFFFFF, 0x00488000,
+    0x00000828, 0xFFFFFFFF, 0xFFFFFFFF, 0x000010C0, 0xFFFFFFFF, 0x00140200, 0x00002110, 0xFFFFFFFF,
+    0x00000830, 0xFFFFFFFF, 0xFFFFFFFF, 0x00070000, 0xFFFFFFFF, 0x00800440, 0x00002108, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x0020C000, 0x00002104, 0xFFFFFFFF, 0x00002102, 0xFFFFFFFF, 0x00002100, 0x00002101,
+    0x00000840, 0x00000841, 0x00000842, 0xFFFFFFFF, 0x00000844, 0xFFFFFFFF, 0xFFFFFFFF, 0x00122000,
+    0x00000848, 0xFFFFFFFF, 0xFFFFFFFF, 0x000010A0, 0xFFFFFFFF, 0x00084100, 0x00C00200, 0xFFFFFFFF,
+    0x00000850, 0xFFFFFFFF, 0xFFFFFFFF, 0x00600100, 0xFFFFFFFF, 0x00800420, 0x00091000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00012200, 0x00024400, 0xFFFFFFFF, 0x00300080, 0xFFFFFFFF, 0xFFFFFFFF, 0x00048800,
+    0x00000860, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001088, 0xFFFFFFFF, 0x00800410, 0x00244000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00001082, 0x00001081, 0x00001080, 0x00038000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001084,
+    0xFFFFFFFF, 0x00800404, 0x00108200, 0xFFFFFFFF, 0x00800401, 0x00800400, 0xFFFFFFFF, 0x00800402,
+    0x004C0000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001090, 0xFFFFFFFF, 0x00800408, 0x00002140, 0xFFFFFFFF,
+    0x00000880, 0x00000881, 0x00000882, 0xFFFFFFFF, 0x00000884, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004210,
+    0x00000888, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001060, 0xFFFFFFFF, 0x0080A000, 0x000E0000, 0xFFFFFFFF,
+    0x00000890, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004204, 0xFFFFFFFF, 0x00004202, 0x00004201, 0x00004200,
+    0xFFFFFFFF, 0x00040500, 0x00418000, 0xFFFFFFFF, 0x00300040, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004208,
+    0x000008A0, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001048, 0xFFFFFFFF, 0x00220100, 0x00910000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00001042, 0x00001041, 0x00001040, 0x00404400, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001044,
+    0xFFFFFFFF, 0x00502000, 0x00280400, 0xFFFFFFFF, 0x00049000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004220,
+    0x00820200, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001050, 0xFFFFFFFF, 0x00090800, 0x00002180, 0xFFFFFFFF,
+    0x000008C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001028, 0xFFFFFFFF, 0x00450000, 0x00008500, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00001022, 0x00001021, 0x00001020, 0x00300010, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001024,
+    0xFFFFFFFF, 0x000A8000, 0x00842000, 0xFFFFFFFF, 0x00300008, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004240,
+    0x00300004, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001030, 0x00300000, 0x00300001, 0x00300002, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x0000100A, 0x00001009, 0x00001008, 0x00082200, 0xFFFFFFFF, 0xFFFFFFFF, 0x0000100C,
+    0x00001003, 0x00001002, 0x00001001, 0x00001000, 0xFFFFFFFF, 0x00001006, 0x00001005, 0x00001004,
+    0x00014100, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001018, 0xFFFFFFFF, 0x00800480, 0x00420800, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00001012, 0x00001011, 0x00001010, 0x00300020, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001014,
+    0x00000900, 0x00000901, 0x00000902, 0xFFFFFFFF, 0x00000904, 0xFFFFFFFF, 0xFFFFFFFF, 0x00841000,
+    0x00000908, 0xFFFFFFFF, 0xFFFFFFFF, 0x00028200, 0xFFFFFFFF, 0x00084040, 0x00002030, 0xFFFFFFFF,
+    0x00000910, 0xFFFFFFFF, 0xFFFFFFFF, 0x00600040, 0xFFFFFFFF, 0x00118000, 0x00002028, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00040480, 0x00002024, 0xFFFFFFFF, 0x00002022, 0xFFFFFFFF, 0x00002020, 0x00002021,
+    0x00000920, 0xFFFFFFFF, 0xFFFFFFFF, 0x00104400, 0xFFFFFFFF, 0x00220080, 0x00002018, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00C10000, 0x00002014, 0xFFFFFFFF, 0x00002012, 0xFFFFFFFF, 0x00002010, 0x00002011,
+    0xFFFFFFFF, 0x00081200, 0x0000200C, 0xFFFFFFFF, 0x0000200A, 0xFFFFFFFF, 0x00002008, 0x00002009,
+    0x00002006, 0xFFFFFFFF, 0x00002004, 0x00002005, 0x00002002, 0x00002003, 0x00002000, 0x00002001,
+    0x00000940, 0xFFFFFFFF, 0xFFFFFFFF, 0x00600010, 0xFFFFFFFF, 0x00084008, 0x00008480, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00084004, 0x00150000, 0xFFFFFFFF, 0x00084001, 0x00084000, 0xFFFFFFFF, 0x00084002,
+    0xFFFFFFFF, 0x00600002, 0x00600001, 0x00600000, 0x00060200, 0xFFFFFFFF, 0xFFFFFFFF, 0x00600004,
+    0x00809000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00600008, 0xFFFFFFFF, 0x00084010, 0x00002060, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x0004A000, 0x008A0000, 0xFFFFFFFF, 0x00501000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010A00,
+    0x00200600, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001180, 0xFFFFFFFF, 0x00084020, 0x00002050, 0xFFFFFFFF,
+    0x00014080, 0xFFFFFFFF, 0xFFFFFFFF, 0x00600020, 0xFFFFFFFF, 0x00800500, 0x00002048, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00120800, 0x00002044, 0xFFFFFFFF, 0x00002042, 0xFFFFFFFF, 0x00002040, 0x00002041,
+    0x00000980, 0xFFFFFFFF, 0xFFFFFFFF, 0x00092000, 0xFFFFFFFF, 0x00220020, 0x00008440, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00040410, 0x00A04000, 0xFFFFFFFF, 0x00011200, 0xFFFFFFFF, 0xFFFFFFFF, 0x00500800,
+    0xFFFFFFFF, 0x00040408, 0x00121000, 0xFFFFFFFF, 0x00C80000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004300,
+    0x00040401, 0x00040400, 0xFFFFFFFF, 0x00040402, 0xFFFFFFFF, 0x00040404, 0x000020A0, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00220004, 0x00440200, 0xFFFFFFFF, 0x00220001, 0x00220000, 0xFFFFFFFF, 0x00220002,
+    0x00188000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001140, 0xFFFFFFFF, 0x00220008, 0x00002090, 0xFFFFFFFF,
+    0x00014040, 0xFFFFFFFF, 0xFFFFFFFF, 0x00808800, 0xFFFFFFFF, 0x00220010, 0x00002088, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00040420, 0x00002084, 0xFFFFFFFF, 0x00002082, 0xFFFFFFFF, 0x00002080, 0x00002081,
+    0xFFFFFFFF, 0x00900200, 0x00008404, 0xFFFFFFFF, 0x00008402, 0xFFFFFFFF, 0x00008400, 0x00008401,
+    0x00422000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001120, 0xFFFFFFFF, 0x00084080, 0x00008408, 0xFFFFFFFF,
+    0x00014020, 0xFFFFFFFF, 0xFFFFFFFF, 0x00600080, 0xFFFFFFFF, 0x00003800, 0x00008410, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00040440, 0x00080A00, 0xFFFFFFFF, 0x00300100, 0xFFFFFFFF, 0xFFFFFFFF, 0x00830000,
+    0x00014010, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001108, 0xFFFFFFFF, 0x00220040, 0x00008420, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00001102, 0x00001101, 0x00001100, 0x00840800, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001104,
+    0x00014000, 0x00014001, 0x00014002, 0xFFFFFFFF, 0x00014004, 0xFFFFFFFF, 0xFFFFFFFF, 0x001C0000,
+    0x00014008, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001110, 0xFFFFFFFF, 0x00408200, 0x000020C0, 0xFFFFFFFF,
+    0x00000A00, 0x00000A01, 0x00000A02, 0xFFFFFFFF, 0x00000A04, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004090,
+    0x00000A08, 0xFFFFFFFF, 0xFFFFFFFF, 0x00028100, 0xFFFFFFFF, 0x00140020, 0x00C00040, 0xFFFFFFFF,
+    0x00000A10, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004084, 0xFFFFFFFF, 0x00004082, 0x00004081, 0x00004080,
+    0xFFFFFFFF, 0x00012040, 0x00241000, 0xFFFFFFFF, 0x00088400, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004088,
+    0x00000A20, 0xFFFFFFFF, 0xFFFFFFFF, 0x00A02000, 0xFFFFFFFF, 0x00140008, 0x00021400, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00140004, 0x00094000, 0xFFFFFFFF, 0x00140001, 0x00140000, 0xFFFFFFFF, 0x00140002,
+    0xFFFFFFFF, 0x00081100, 0x00108040, 0xFFFFFFFF, 0x00610000, 0xFFFFFFFF, 0xFFFFFFFF, 0x000040A0,
+    0x00820080, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400C00, 0xFFFFFFFF, 0x00140010, 0x00002300, 0xFFFFFFFF,
+    0x00000A40, 0xFFFFFFFF, 0xFFFFFFFF, 0x000C0400, 0xFFFFFFFF, 0x00209000, 0x00C00008, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00012010, 0x00C00004, 0xFFFFFFFF, 0x00C00002, 0xFFFFFFFF, 0x00C00000, 0x00C00001,
+    0xFFFFFFFF, 0x00012008, 0x00108020, 0xFFFFFFFF, 0x00060100, 0xFFFFFFFF, 0xFFFFFFFF, 0x000040C0,
+    0x00012001, 0x00012000, 0xFFFFFFFF, 0x00012002, 0xFFFFFFFF, 0x00012004, 0x00C00010, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00424000, 0x00108010, 0xFFFFFFFF, 0x00082080, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010900,
+    0x00200500, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001280, 0xFFFFFFFF, 0x00140040, 0x00C00020, 0xFFFFFFFF,
+    0x00108002, 0xFFFFFFFF, 0x00108000, 0x00108001, 0xFFFFFFFF, 0x00800600, 0x00108004, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00012020, 0x00108008, 0xFFFFFFFF, 0x00005800, 0xFFFFFFFF, 0xFFFFFFFF, 0x002A0000,
+    0x00000A80, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004014, 0xFFFFFFFF, 0x00004012, 0x00004011, 0x00004010,
+    0xFFFFFFFF, 0x00680000, 0x00102400, 0xFFFFFFFF, 0x00011100, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004018,
+    0xFFFFFFFF, 0x00004006, 0x00004005, 0x00004004, 0x00004003, 0x00004002, 0x00004001, 0x00004000,
+    0x00820020, 0xFFFFFFFF, 0xFFFFFFFF, 0x0000400C, 0xFFFFFFFF, 0x0000400A, 0x00004009, 0x00004008,
+    0xFFFFFFFF, 0x00018400, 0x00440100, 0xFFFFFFFF, 0x00082040, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004030,
+    0x00820010, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001240, 0xFFFFFFFF, 0x00140080, 0x00208800, 0xFFFFFFFF,
+    0x00820008, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004024, 0xFFFFFFFF, 0x00004022, 0x00004021, 0x00004020,
+    0x00820000, 0x00820001, 0x00820002, 0xFFFFFFFF, 0x00820004, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004028,
+    0xFFFFFFFF, 0x00900100, 0x00230000, 0xFFFFFFFF, 0x00082020, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004050,
+    0x0004C000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001220, 0xFFFFFFFF, 0x00020C00, 0x00C00080, 0xFFFFFFFF,
+    0x00401400, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004044, 0xFFFFFFFF, 0x00004042, 0x00004041, 0x00004040,
+    0xFFFFFFFF, 0x00012080, 0x00080900, 0xFFFFFFFF, 0x00300200, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004048,
+    0x00082004, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001208, 0x00082000, 0x00082001, 0x00082002, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00001202, 0x00001201, 0x00001200, 0x00082008, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001204,
+    0xFFFFFFFF, 0x00240800, 0x00108080, 0xFFFFFFFF, 0x00082010, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004060,
+    0x00820040, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001210, 0xFFFFFFFF, 0x00408100, 0x00050400, 0xFFFFFFFF,
+    0x00000B00, 0xFFFFFFFF, 0xFFFFFFFF, 0x00028008, 0xFFFFFFFF, 0x00402400, 0x00380000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00028002, 0x00028001, 0x00028000, 0x00011080, 0xFFFFFFFF, 0xFFFFFFFF, 0x00028004,
+    0xFFFFFFFF, 0x00081020, 0x00810400, 0xFFFFFFFF, 0x00060040, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004180,
+    0x00504000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00028010, 0xFFFFFFFF, 0x00A00800, 0x00002220, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00081010, 0x00440080, 0xFFFFFFFF, 0x0080C000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010840,
+    0x00200440, 0xFFFFFFFF, 0xFFFFFFFF, 0x00028020, 0xFFFFFFFF, 0x00140100, 0x00002210, 0xFFFFFFFF,
+    0x00081001, 0x00081000, 0xFFFFFFFF, 0x00081002, 0xFFFFFFFF, 0x00081004, 0x00002208, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00081008, 0x00002204, 0xFFFFFFFF, 0x00002202, 0xFFFFFFFF, 0x00002200, 0x00002201,
+    0xFFFFFFFF, 0x00900080, 0x00007000, 0xFFFFFFFF, 0x00060010, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010820,
+    0x00200420, 0xFFFFFFFF, 0xFFFFFFFF, 0x00028040, 0xFFFFFFFF, 0x00084200, 0x00C00100, 0xFFFFFFFF,
+    0x00060004, 0xFFFFFFFF, 0xFFFFFFFF, 0x00600200, 0x00060000, 0x00060001, 0x00060002, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00012100, 0x00080880, 0xFFFFFFFF, 0x00060008, 0xFFFFFFFF, 0xFFFFFFFF, 0x00101400,
+    0x00200408, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010804, 0xFFFFFFFF, 0x00010802, 0x00010801, 0x00010800,
+    0x00200400, 0x00200401, 0x00200402, 0xFFFFFFFF, 0x00200404, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010808,
+    0xFFFFFFFF, 0x00081040, 0x00108100, 0xFFFFFFFF, 0x00060020, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010810,
+    0x00200410, 0xFFFFFFFF, 0xFFFFFFFF, 0x00844000, 0xFFFFFFFF, 0x00408080, 0x00002240, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00900040, 0x00440020, 0xFFFFFFFF, 0x00011008, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004110,
+    0x00011004, 0xFFFFFFFF, 0xFFFFFFFF, 0x00028080, 0x00011000, 0x00011001, 0x00011002, 0xFFFFFFFF,
+    0x0020A000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004104, 0xFFFFFFFF, 0x00004102, 0x00004101, 0x00004100,
+    0xFFFFFFFF, 0x00040600, 0x00080840, 0xFFFFFFFF, 0x00011010, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004108,
+    0x00440002, 0xFFFFFFFF, 0x00440000, 0x00440001, 0xFFFFFFFF, 0x00220200, 0x00440004, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00006800, 0x00440008, 0xFFFFFFFF, 0x00011020, 0xFFFFFFFF, 0xFFFFFFFF, 0x00880400,
+    0xFFFFFFFF, 0x00081080, 0x00440010, 0xFFFFFFFF, 0x00100C00, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004120,
+    0x00820100, 0xFFFFFFFF, 0xFFFFFFFF, 0x00310000, 0xFFFFFFFF, 0x00408040, 0x00002280, 0xFFFFFFFF,
+    0x00900001, 0x00900000, 0xFFFFFFFF, 0x00900002, 0xFFFFFFFF, 0x00900004, 0x00008600, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00900008, 0x00080810, 0xFFFFFFFF, 0x00011040, 0xFFFFFFFF, 0xFFFFFFFF, 0x00242000,
+    0xFFFFFFFF, 0x00900010, 0x00080808, 0xFFFFFFFF, 0x00060080, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004140,
+    0x00080802, 0xFFFFFFFF, 0x00080800, 0x00080801, 0xFFFFFFFF, 0x00408020, 0x00080804, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00900020, 0x00440040, 0xFFFFFFFF, 0x00082100, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010880,
+    0x00200480, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001300, 0xFFFFFFFF, 0x00408010, 0x00124000, 0xFFFFFFFF,
+    0x00014200, 0xFFFFFFFF, 0xFFFFFFFF, 0x00022400, 0xFFFFFFFF, 0x00408008, 0x00A01000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00408004, 0x00080820, 0xFFFFFFFF, 0x00408001, 0x00408000, 0xFFFFFFFF, 0x00408002,
+    0x00000C00, 0x00000C01, 0x00000C02, 0xFFFFFFFF, 0x00000C04, 0xFFFFFFFF, 0xFFFFFFFF, 0x00210008,
+    0x00000C08, 0xFFFFFFFF, 0xFFFFFFFF, 0x00210004, 0xFFFFFFFF, 0x00210002, 0x00210001, 0x00210000,
+    0x00000C10, 0xFFFFFFFF, 0xFFFFFFFF, 0x0000B000, 0xFFFFFFFF, 0x00800060, 0x00540000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00040180, 0x00024040, 0xFFFFFFFF, 0x00088200, 0xFFFFFFFF, 0xFFFFFFFF, 0x00210010,
+    0x00000C20, 0xFFFFFFFF, 0xFFFFFFFF, 0x00104100, 0xFFFFFFFF, 0x00800050, 0x00021200, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x000A2000, 0x00848000, 0xFFFFFFFF, 0x00404080, 0xFFFFFFFF, 0xFFFFFFFF, 0x00210020,
+    0xFFFFFFFF, 0x00800044, 0x00280080, 0xFFFFFFFF, 0x00800041, 0x00800040, 0xFFFFFFFF, 0x00800042,
+    0x00111000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400A00, 0xFFFFFFFF, 0x00800048, 0x00002500, 0xFFFFFFFF,
+    0x00000C40, 0xFFFFFFFF, 0xFFFFFFFF, 0x000C0200, 0xFFFFFFFF, 0x00800030, 0x00008180, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00508000, 0x00024010, 0xFFFFFFFF, 0x00043000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00210040,
+    0xFFFFFFFF, 0x00800024, 0x00024008, 0xFFFFFFFF, 0x00800021, 0x00800020, 0xFFFFFFFF, 0x00800022,
+    0x00024002, 0xFFFFFFFF, 0x00024000, 0x00024001, 0xFFFFFFFF, 0x00800028, 0x00024004, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00800014, 0x00412000, 0xFFFFFFFF, 0x00800011, 0x00800010, 0xFFFFFFFF, 0x00800012,
+    0x00200300, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001480, 0xFFFFFFFF, 0x00800018, 0x00180800, 0xFFFFFFFF,
+    0x00800005, 0x00800004, 0xFFFFFFFF, 0x00800006, 0x00800001, 0x00800000, 0x00800003, 0x00800002,
+    0xFFFFFFFF, 0x0080000C, 0x00024020, 0xFFFFFFFF, 0x00800009, 0x00800008, 0xFFFFFFFF, 0x0080000A,
+    0x00000C80, 0xFFFFFFFF, 0xFFFFFFFF, 0x00C20000, 0xFFFFFFFF, 0x00181000, 0x00008140, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00040110, 0x00102200, 0xFFFFFFFF, 0x00404020, 0xFFFFFFFF, 0xFFFFFFFF, 0x00210080,
+    0xFFFFFFFF, 0x00040108, 0x00280020, 0xFFFFFFFF, 0x00032000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004600,
+    0x00040101, 0x00040100, 0xFFFFFFFF, 0x00040102, 0xFFFFFFFF, 0x00040104, 0x00801800, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00018200, 0x00280010, 0xFFFFFFFF, 0x00404008, 0xFFFFFFFF, 0xFFFFFFFF, 0x00042800,
+    0x00404004, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001440, 0x00404000, 0x00404001, 0x00404002, 0xFFFFFFFF,
+    0x00280002, 0xFFFFFFFF, 0x00280000, 0x00280001, 0xFFFFFFFF, 0x008000C0, 0x00280004, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00040120, 0x00280008, 0xFFFFFFFF, 0x00404010, 0xFFFFFFFF, 0xFFFFFFFF, 0x00128000,
+    0xFFFFFFFF, 0x00206000, 0x00008104, 0xFFFFFFFF, 0x00008102, 0xFFFFFFFF, 0x00008100, 0x00008101,
+    0x00890000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001420, 0xFFFFFFFF, 0x00020A00, 0x00008108, 0xFFFFFFFF,
+    0x00401200, 0xFFFFFFFF, 0xFFFFFFFF, 0x00110800, 0xFFFFFFFF, 0x008000A0, 0x00008110, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00040140, 0x00024080, 0xFFFFFFFF, 0x00300400, 0xFFFFFFFF, 0xFFFFFFFF, 0x00482000,
+    0x00160000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001408, 0xFFFFFFFF, 0x00800090, 0x00008120, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00001402, 0x00001401, 0x00001400, 0x00404040, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001404,
+    0xFFFFFFFF, 0x00800084, 0x00280040, 0xFFFFFFFF, 0x00800081, 0x00800080, 0xFFFFFFFF, 0x00800082,
+    0x0000A800, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001410, 0xFFFFFFFF, 0x00800088, 0x00050200, 0xFFFFFFFF,
+    0x00000D00, 0xFFFFFFFF, 0xFFFFFFFF, 0x00104020, 0xFFFFFFFF, 0x00402200, 0x000080C0, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00040090, 0x00481000, 0xFFFFFFFF, 0x00920000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00210100,
+    0xFFFFFFFF, 0x00040088, 0x00810200, 0xFFFFFFFF, 0x00205000, 0xFFFFFFFF, 0xFFFFFFFF, 0x000A0800,
+    0x00040081, 0x00040080, 0xFFFFFFFF, 0x00040082, 0xFFFFFFFF, 0x00040084, 0x00002420, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00104002, 0x00104001, 0x00104000, 0x000D0000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00104004,
+    0x00200240, 0xFFFFFFFF, 0xFFFFFFFF, 0x00104008, 0xFFFFFFFF, 0x00009800, 0x00002410, 0xFFFFFFFF,
+    0x00428000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00104010, 0xFFFFFFFF, 0x00800140, 0x00002408, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x000400A0, 0x00002404, 0xFFFFFFFF, 0x00002402, 0xFFFFFFFF, 0x00002400, 0x00002401,
+    0xFFFFFFFF, 0x00031000, 0x00008084, 0xFFFFFFFF, 0x00008082, 0xFFFFFFFF, 0x00008080, 0x00008081,
+    0x00200220, 0xFFFFFFFF, 0xFFFFFFFF, 0x00802800, 0xFFFFFFFF, 0x00084400, 0x00008088, 0xFFFFFFFF,
+    0x00182000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00600400, 0xFFFFFFFF, 0x00800120, 0x00008090, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x000400C0, 0x00024100, 0xFFFFFFFF, 0x00410800, 0xFFFFFFFF, 0xFFFFFFFF, 0x00101200,
+    0x00200208, 0xFFFFFFFF, 0xFFFFFFFF, 0x00104040, 0xFFFFFFFF, 0x00800110, 0x000080A0, 0xFFFFFFFF,
+    0x00200200, 0x00200201, 0x00200202, 0xFFFFFFFF, 0x00200204, 0xFFFFFFFF, 0xFFFFFFFF, 0x00460000,
+    0xFFFFFFFF, 0x00800104, 0x00041800, 0xFFFFFFFF, 0x00800101, 0x00800100, 0xFFFFFFFF, 0x00800102,
+    0x00200210, 0xFFFFFFFF, 0xFFFFFFFF, 0x00098000, 0xFFFFFFFF, 0x00800108, 0x00002440, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00040018, 0x00008044, 0xFFFFFFFF, 0x00008042, 0xFFFFFFFF, 0x00008040, 0x00008041,
+    0x00040011, 0x00040010, 0xFFFFFFFF, 0x00040012, 0xFFFFFFFF, 0x00040014, 0x00008048, 0xFFFFFFFF,
+    0x00040009, 0x00040008, 0xFFFFFFFF, 0x0004000A, 0xFFFFFFFF, 0x0004000C, 0x00008050, 0xFFFFFFFF,
+    0x00040001, 0x00040000, 0x00040003, 0x00040002, 0x00040005, 0x00040004, 0xFFFFFFFF, 0x00040006,
+    0x00803000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00104080, 0xFFFFFFFF, 0x00220400, 0x00008060, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00040030, 0x00030800, 0xFFFFFFFF, 0x00404100, 0xFFFFFFFF, 0xFFFFFFFF, 0x00880200,
+    0xFFFFFFFF, 0x00040028, 0x00280100, 0xFFFFFFFF, 0x00100A00, 0xFFFFFFFF, 0xFFFFFFFF, 0x00411000,
+    0x00040021, 0x00040020, 0xFFFFFFFF, 0x00040022, 0xFFFFFFFF, 0x00040024, 0x00002480, 0xFFFFFFFF,
+    0x00008006, 0xFFFFFFFF, 0x00008004, 0x00008005, 0x00008002, 0x00008003, 0x00008000, 0x00008001,
+    0xFFFFFFFF, 0x00040050, 0x0000800C, 0xFFFFFFFF, 0x0000800A, 0xFFFFFFFF, 0x00008008, 0x00008009,
+    0xFFFFFFFF, 0x00040048, 0x00008014, 0xFFFFFFFF, 0x00008012, 0xFFFFFFFF, 0x00008010, 0x00008011,
+    0x00040041, 0x00040040, 0xFFFFFFFF, 0x00040042, 0xFFFFFFFF, 0x00040044, 0x00008018, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00480800, 0x00008024, 0xFFFFFFFF, 0x00008022, 0xFFFFFFFF, 0x00008020, 0x00008021,
+    0x00200280, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001500, 0xFFFFFFFF, 0x00112000, 0x00008028, 0xFFFFFFFF,
+    0x00014400, 0xFFFFFFFF, 0xFFFFFFFF, 0x00022200, 0xFFFFFFFF, 0x00800180, 0x00008030, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00040060, 0x00D00000, 0xFFFFFFFF, 0x000A1000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00204800,
+    0x00000E00, 0xFFFFFFFF, 0xFFFFFFFF, 0x000C0040, 0xFFFFFFFF, 0x00402100, 0x00021020, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00805000, 0x00102080, 0xFFFFFFFF, 0x00088010, 0xFFFFFFFF, 0xFFFFFFFF, 0x00210200,
+    0xFFFFFFFF, 0x00320000, 0x00810100, 0xFFFFFFFF, 0x00088008, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004480,
+    0x00088004, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400820, 0x00088000, 0x00088001, 0x00088002, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00018080, 0x00021004, 0xFFFFFFFF, 0x00021002, 0xFFFFFFFF, 0x00021000, 0x00021001,
+    0x00200140, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400810, 0xFFFFFFFF, 0x00140400, 0x00021008, 0xFFFFFFFF,
+    0x00046000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400808, 0xFFFFFFFF, 0x00800240, 0x00021010, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00400802, 0x00400801, 0x00400800, 0x00088020, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400804,
+    0xFFFFFFFF, 0x000C0002, 0x000C0001, 0x000C0000, 0x00114000, 0xFFFFFFFF, 0xFFFFFFFF, 0x000C0004,
+    0x00200120, 0xFFFFFFFF, 0xFFFFFFFF, 0x000C0008, 0xFFFFFFFF, 0x00020880, 0x00C00400, 0xFFFFFFFF,
+    0x00401080, 0xFFFFFFFF, 0xFFFFFFFF, 0x000C0010, 0xFFFFFFFF, 0x00800220, 0x00202800, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00012400, 0x00024200, 0xFFFFFFFF, 0x00088040, 0xFFFFFFFF, 0xFFFFFFFF, 0x00101100,
+    0x00200108, 0xFFFFFFFF, 0xFFFFFFFF, 0x000C0020, 0xFFFFFFFF, 0x00800210, 0x00021040, 0xFFFFFFFF,
+    0x00200100, 0x00200101, 0x00200102, 0xFFFFFFFF, 0x00200104, 0xFFFFFFFF, 0xFFFFFFFF, 0x0000E000,
+    0xFFFFFFFF, 0x00800204, 0x00108400, 0xFFFFFFFF, 0x00800201, 0x00800200, 0xFFFFFFFF, 0x00800202,
+    0x00200110, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400840, 0xFFFFFFFF, 0x00800208, 0x00050080, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00018020, 0x00102008, 0xFFFFFFFF, 0x00A40000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004410,
+    0x00102002, 0xFFFFFFFF, 0x00102000, 0x00102001, 0xFFFFFFFF, 0x00020840, 0x00102004, 0xFFFFFFFF,
+    0x00401040, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004404, 0xFFFFFFFF, 0x00004402, 0x00004401, 0x00004400,
+    0xFFFFFFFF, 0x00040300, 0x00102010, 0xFFFFFFFF, 0x00088080, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004408,
+    0x00018001, 0x00018000, 0xFFFFFFFF, 0x00018002, 0xFFFFFFFF, 0x00018004, 0x00021080, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00018008, 0x00102020, 0xFFFFFFFF, 0x00404200, 0xFFFFFFFF, 0xFFFFFFFF, 0x00880100,
+    0xFFFFFFFF, 0x00018010, 0x00280200, 0xFFFFFFFF, 0x00100900, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004420,
+    0x00820400, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400880, 0xFFFFFFFF, 0x00203000, 0x00050040, 0xFFFFFFFF,
+    0x00401010, 0xFFFFFFFF, 0xFFFFFFFF, 0x000C0080, 0xFFFFFFFF, 0x00020808, 0x00008300, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00020804, 0x00102040, 0xFFFFFFFF, 0x00020801, 0x00020800, 0xFFFFFFFF, 0x00020802,
+    0x00401000, 0x00401001, 0x00401002, 0xFFFFFFFF, 0x00401004, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004440,
+    0x00401008, 0xFFFFFFFF, 0xFFFFFFFF, 0x00A08000, 0xFFFFFFFF, 0x00020810, 0x00050020, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00018040, 0x00804800, 0xFFFFFFFF, 0x00082400, 0xFFFFFFFF, 0xFFFFFFFF, 0x00700000,
+    0x00200180, 0xFFFFFFFF, 0xFFFFFFFF, 0x00001600, 0xFFFFFFFF, 0x00020820, 0x00050010, 0xFFFFFFFF,
+    0x00401020, 0xFFFFFFFF, 0xFFFFFFFF, 0x00022100, 0xFFFFFFFF, 0x00800280, 0x00050008, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00184000, 0x00050004, 0xFFFFFFFF, 0x00050002, 0xFFFFFFFF, 0x00050000, 0x00050001,
+    0xFFFFFFFF, 0x00402004, 0x00810010, 0xFFFFFFFF, 0x00402001, 0x00402000, 0xFFFFFFFF, 0x00402002,
+    0x00200060, 0xFFFFFFFF, 0xFFFFFFFF, 0x00028400, 0xFFFFFFFF, 0x00402008, 0x00044800, 0xFFFFFFFF,
+    0x00810002, 0xFFFFFFFF, 0x00810000, 0x00810001, 0xFFFFFFFF, 0x00402010, 0x00810004, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00040280, 0x00810008, 0xFFFFFFFF, 0x00088100, 0xFFFFFFFF, 0xFFFFFFFF, 0x00101040,
+    0x00200048, 0xFFFFFFFF, 0xFFFFFFFF, 0x00104200, 0xFFFFFFFF, 0x00402020, 0x00021100, 0xFFFFFFFF,
+    0x00200040, 0x00200041, 0x00200042, 0xFFFFFFFF, 0x00200044, 0xFFFFFFFF, 0xFFFFFFFF, 0x00880080,
+    0xFFFFFFFF, 0x00081400, 0x00810020, 0xFFFFFFFF, 0x00100880, 0xFFFFFFFF, 0xFFFFFFFF, 0x00248000,
+    0x00200050, 0xFFFFFFFF, 0xFFFFFFFF, 0x00400900, 0xFFFFFFFF, 0x00034000, 0x00002600, 0xFFFFFFFF,
+    0x00200028, 0xFFFFFFFF, 0xFFFFFFFF, 0x000C0100, 0xFFFFFFFF, 0x00402040, 0x00008280, 0xFFFFFFFF,
+    0x00200020, 0x00200021, 0x00200022, 0xFFFFFFFF, 0x00200024, 0xFFFFFFFF, 0xFFFFFFFF, 0x00101010,
+    0xFFFFFFFF, 0x0000C800, 0x00810040, 0xFFFFFFFF, 0x00060400, 0xFFFFFFFF, 0xFFFFFFFF, 0x00101008,
+    0x00200030, 0xFFFFFFFF, 0xFFFFFFFF, 0x00101004, 0xFFFFFFFF, 0x00101002, 0x00101001, 0x00101000,
+    0x00200008, 0x00200009, 0x0020000A, 0xFFFFFFFF, 0x0020000C, 0xFFFFFFFF, 0xFFFFFFFF, 0x00010C00,
+    0x00200000, 0x00200001, 0x00200002, 0x00200003, 0x00200004, 0x00200005, 0x00200006, 0xFFFFFFFF,
+    0x00200018, 0xFFFFFFFF, 0xFFFFFFFF, 0x00022080, 0xFFFFFFFF, 0x00800300, 0x00484000, 0xFFFFFFFF,
+    0x00200010, 0x00200011, 0x00200012, 0xFFFFFFFF, 0x00200014, 0xFFFFFFFF, 0xFFFFFFFF, 0x00101020,
+    0x000A4000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00201800, 0xFFFFFFFF, 0x00402080, 0x00008240, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00040210, 0x00102100, 0xFFFFFFFF, 0x00011400, 0xFFFFFFFF, 0xFFFFFFFF, 0x00880020,
+    0xFFFFFFFF, 0x00040208, 0x00810080, 0xFFFFFFFF, 0x00100820, 0xFFFFFFFF, 0xFFFFFFFF, 0x00004500,
+    0x00040201, 0x00040200, 0xFFFFFFFF, 0x00040202, 0xFFFFFFFF, 0x00040204, 0x00620000, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00018100, 0x00440400, 0xFFFFFFFF, 0x00100810, 0xFFFFFFFF, 0xFFFFFFFF, 0x00880008,
+    0x002000C0, 0xFFFFFFFF, 0xFFFFFFFF, 0x00880004, 0xFFFFFFFF, 0x00880002, 0x00880001, 0x00880000,
+    0x00100804, 0xFFFFFFFF, 0xFFFFFFFF, 0x00022040, 0x00100800, 0x00100801, 0x00100802, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00040220, 0x0000D000, 0xFFFFFFFF, 0x00100808, 0xFFFFFFFF, 0xFFFFFFFF, 0x00880010,
+    0xFFFFFFFF, 0x00900400, 0x00008204, 0xFFFFFFFF, 0x00008202, 0xFFFFFFFF, 0x00008200, 0x00008201,
+    0x002000A0, 0xFFFFFFFF, 0xFFFFFFFF, 0x00414000, 0xFFFFFFFF, 0x00020900, 0x00008208, 0xFFFFFFFF,
+    0x00401100, 0xFFFFFFFF, 0xFFFFFFFF, 0x00022020, 0xFFFFFFFF, 0x00290000, 0x00008210, 0xFFFFFFFF,
+    0xFFFFFFFF, 0x00040240, 0x00080C00, 0xFFFFFFFF, 0x00806000, 0xFFFFFFFF, 0xFFFFFFFF, 0x00101080,
+    0x00200088, 0xFFFFFFFF, 0xFFFFFFFF, 0x00022010, 0xFFFFFFFF, 0x00045000, 0x00008220, 0xFFFFFFFF,
+    0x00200080, 0x00200081, 0x00200082, 0xFFFFFFFF, 0x00200084, 0xFFFFFFFF, 0xFFFFFFFF, 0x00880040,
+    0xFFFFFFFF, 0x00022002, 0x00022001, 0x00022000, 0x00100840, 0xFFFFFFFF, 0xFFFFFFFF, 0x00022004,
+    0x00200090, 0xFFFFFFFF, 0xFFFFFFFF, 0x00022008, 0xFFFFFFFF, 0x00408400, 0x00050100, 0xFFFFFFFF
+};
+
 /**
  * @brief Encode a 12-bit value with Golay(24, 12).
  *
@@ -214,6 +743,8 @@ static uint32_t s_detect_errors(const uint16_t* codeword)
 
 /**
  * @brief Soft decode Golay(24, 12) codeword.
+ * Codewords with no marginal bits are decoded with the syndrome table,
+ * the soft search runs only if some bit is uncertain or there are 4 errors.
  *
  * @param codeword Pointer to a 24-element soft-valued (fixed-point) bit codeword.
  * @return uint16_t Decoded data.
@@ -222,8 +753,23 @@ uint16_t golay24_sdecode(const uint16_t codeword[24])
 {
     //match the bit order in M17
     uint16_t cw[24]; //local copy
+    uint32_t hard=0; //hard decisions
+    uint8_t marginal=0; //set if any bit is close to the decision threshold
     for(uint8_t i=0; i<24; i++)
+    {
         cw[i]=codeword[23-i];
+        hard|=(uint32_t)(cw[i]>0x7FFF)<<i;
+        marginal|=(uint16_t)(cw[i]-(0x8000-M17_GOLAY_HARD_MARGIN))<2*M17_GOLAY_HARD_MARGIN;
+    }
+
+    //fast path - all bits confident, look the error pattern up by its syndrome
+    if(!marginal)
+    {
+        uint16_t syndrome=(hard^golay24_encode(hard>>12))&0x0FFF;
+
+        if(golay_syndrome_table[syndrome]!=0xFFFFFFFFUL)
+            return ((hard^golay_syndrome_table[syndrome])>>12)&0x0FFF;
+    }
 
     uint32_t errors = s_detect_errors(cw);
 
@@ -233,6 +779,354 @@ uint16_t golay24_sdecode(const uint16_t codeword[24])
     return (((soft_to_int(&cw[0], 16) | (soft_to_int(&cw[16], 8) << 16)) ^ errors) >> 12) & 0x0FFF;
 }
 
+/**
+ * @brief Build a table of sums over all subsets of 6 values.
+ *
+ * @param out Output - 64 sums, bit n of the index selects in[n].
+ * @param in Input - 6 values.
+ */
+static void subset_sums(int32_t out[64], const int32_t in[6])
+{
+    out[0]=0;
+    for(uint8_t b=0; b<6; b++)
+    {
+        for(uint8_t x=0; x<(1<<b); x++)
+            out[x|(1<<b)]=out[x]+in[b];
+    }
+}
+
+/**
+ * @brief Maximum likelihood soft decode Golay(24, 12) codeword.
+ * All 4096 codewords are scored against the soft input, so the amount of work
+ * does not depend on the data. Each score is assembled from four 64-entry
+ * partial sum tables (data and parity bits split into 6-bit halves)
+ * instead of a 24-term correlation.
+ *
+ * @param codeword Pointer to a 24-element soft-valued (fixed-point) bit codeword.
+ * @param margin Output - score difference between the best and the runner-up codeword,
+ *   in soft bit units (0xFFFF is one full bit). A small margin means an unreliable decision. Can be NULL.
+ * @return uint16_t Decoded data.
+ */
+uint16_t golay24_sdecode_ml(const uint16_t codeword[24], uint32_t* margin)
+{
+    int32_t w[24];          //cost of a set bit relative to a cleared one, M17 bit order reversed
+    int32_t d_lo[64], d_hi[64], p_lo[64], p_hi[64];
+    int32_t e_lo[64], e_hi[64]; //checksums of the data halves
+    int32_t em[12];
+
+    for(uint8_t i=0; i<24; i++)
+        w[i]=0xFFFF-2*(int32_t)codeword[23-i];
+    for(uint8_t i=0; i<12; i++)
+        em[i]=encode_matrix[i];
+
+    subset_sums(p_lo, &w[0]);
+    subset_sums(p_hi, &w[6]);
+    subset_sums(d_lo, &w[12]);
+    subset_sums(d_hi, &w[18]);
+
+    //checksums XOR-combine, so build them the same way with XOR in place of the sum
+    e_lo[0]=e_hi[0]=0;
+    for(uint8_t b=0; b<6; b++)
+    {
+        for(uint8_t x=0; x<(1<<b); x++)
+        {
+            e_lo[x|(1<<b)]=e_lo[x]^em[b];
+            e_hi[x|(1<<b)]=e_hi[x]^em[b+6];
+        }
+    }
+
+    int32_t best=INT32_MAX, second=INT32_MAX;
+    uint16_t best_data=0;
+
+    for(uint8_t hi=0; hi<64; hi++)
+    {
+        for(uint8_t lo=0; lo<64; lo++)
+        {
+            int32_t p=e_lo[lo]^e_hi[hi];
+            int32_t cost=d_lo[lo]+d_hi[hi]+p_lo[p&0x3F]+p_hi[p>>6];
+
+            if(cost<best)
+            {
+                second=best;
+                best=cost;
+                best_data=((uint16_t)hi<<6)|lo;
+            }
+            else if(cost<second)
+            {
+                second=cost;
+            }
+        }
+    }
+
+    if(margin!=NULL)
+        *margin=(uint32_t)(second-best);
+
+    return best_data;
+}
+
+/**
+ * @brief Branchless soft XOR with a hard bit.
+ * Bit-exact with `soft_bit_XOR(a, mask)` for mask equal to 0x0000 or 0xFFFF.
+ *
+ * @param a Soft input.
+ * @param mask Hard input, 0x0000 or 0xFFFF.
+ * @return uint16_t Output = A xor B.
+ */
+static inline uint16_t ct_XOR(uint16_t a, uint16_t mask)
+{
+    uint16_t y=a^mask;
+
+    return y-(y!=0);
+}
+
+/**
+ * @brief Soft weight of a 12-element soft vector XORed with a 12-bit hard row.
+ *
+ * @param in Soft vector.
+ * @param row Hard row, LSB at index 0.
+ * @return uint32_t Soft popcount of the XOR.
+ */
+static uint32_t ct_weight(const uint16_t in[12], uint16_t row)
+{
+    uint32_t w=0;
+
+    for(uint8_t i=0; i<12; i++)
+        w+=ct_XOR(in[i], -((row>>i)&1));
+
+    return w;
+}
+
+/**
+ * @brief Branchless hard decision of a 12-element soft vector.
+ *
+ * @param in Soft vector.
+ * @return uint16_t Hard bits, LSB at index 0.
+ */
+static uint16_t ct_to_int(const uint16_t in[12])
+{
+    uint16_t r=0;
+
+    for(uint8_t i=0; i<12; i++)
+        r|=(in[i]>>15)<<i;
+
+    return r;
+}
+
+/**
+ * @brief Constant-time soft decode Golay(24, 12) codeword.
+ * Returns the same value as the soft search of golay24_sdecode(), but every stage
+ * of the search is evaluated for every codeword and the result is picked with masks,
+ * so the execution time does not depend on the data. The work is fixed at
+ * 1+12+66+1+12=92 twelve-element soft weight evaluations plus the 12-row checksum
+ * and the 12-row inverse syndrome (about 1400 soft bit operations), all without
+ * data-dependent branches or table indexing. Measured at about 3700 cycles
+ * on x86-64 (GCC -O2), which also bounds the soft search of golay24_sdecode().
+ *
+ * @param codeword Pointer to a 24-element soft-valued (fixed-point) bit codeword.
+ * @return uint16_t Decoded data, 0xFFFF if the errors could not be corrected.
+ */
+uint16_t golay24_sdecode_ct(const uint16_t codeword[24])
+{
+    uint16_t cw[24];            //local copy, M17 bit order reversed
+    uint16_t cksum[12]={0};
+    uint16_t syndrome[12];
+    uint16_t inv_syndrome[12]={0};
+    uint32_t res=0xFFFFFFFFUL;  //error vector
+    uint32_t found=0;           //all ones once a stage has accepted a candidate
+    uint32_t take;
+    uint16_t s, inv;
+
+    for(uint8_t i=0; i<24; i++)
+        cw[i]=codeword[23-i];
+
+    //checksum of the data part, XOR with every row kept or discarded with a mask
+    for(uint8_t i=0; i<12; i++)
+    {
+        uint16_t sel=-(cw[12+i]>>15);
+
+        for(uint8_t j=0; j<12; j++)
+        {
+            uint16_t tmp=ct_XOR(cksum[j], -((encode_matrix[i]>>j)&1));
+            cksum[j]=(tmp&sel)|(cksum[j]&~sel);
+        }
+    }
+
+    soft_XOR(syndrome, cw, cksum, 12);
+    s=ct_to_int(syndrome);
+
+    //all (less than 4) errors in the parity part
+    take=-(uint32_t)(s_popcount(syndrome, 12)<4*0xFFFE);
+    res=(res&~take)|(s&take);
+    found|=take;
+
+    //one of the errors in data part, up to 3 in parity
+    for(uint8_t i=0; i<12; i++)
+    {
+        uint32_t m=-(uint32_t)(ct_weight(syndrome, encode_matrix[i])<3*0xFFFE);
+
+        take=m&~found;
+        res=(res&~take)|((((uint32_t)1<<(i+12))|(s^encode_matrix[i]))&take);
+        found|=m;
+    }
+
+    //two of the errors in data part and up to 2 in parity
+    for(uint8_t i=0; i<11; i++)
+    {
+        for(uint8_t j=i+1; j<12; j++)
+        {
+            uint16_t coded_error=encode_matrix[i]^encode_matrix[j];
+            uint32_t m=-(uint32_t)(ct_weight(syndrome, coded_error)<2*0xFFFF);
+
+            take=m&~found;
+            res=(res&~take)|((((uint32_t)1<<(i+12))|((uint32_t)1<<(j+12))|(s^coded_error))&take);
+            found|=m;
+        }
+    }
+
+    //algebraic decoding
+    for(uint8_t i=0; i<12; i++)
+    {
+        uint16_t sel=-(syndrome[i]>>15);
+
+        for(uint8_t j=0; j<12; j++)
+        {
+            uint16_t tmp=ct_XOR(inv_syndrome[j], -((decode_matrix[i]>>j)&1));
+            inv_syndrome[j]=(tmp&sel)|(inv_syndrome[j]&~sel);
+        }
+    }
+    inv=ct_to_int(inv_syndrome);
+
+    //all (less than 4) errors in the data part
+    uint32_t m=-(uint32_t)(s_popcount(inv_syndrome, 12)<4*0xFFFF);
+    take=m&~found;
+    res=(res&~take)|(((uint32_t)inv<<12)&take);
+    found|=m;
+
+    //one error in parity bits, up to 3 in data
+    for(uint8_t i=0; i<12; i++)
+    {
+        m=-(uint32_t)(ct_weight(inv_syndrome, decode_matrix[i])<3*(0xFFFF+2));
+        take=m&~found;
+        res=(res&~take)|(((((uint32_t)inv^decode_matrix[i])<<12)|((uint32_t)1<<i))&take);
+        found|=m;
+    }
+
+    uint32_t hard=((uint32_t)ct_to_int(&cw[12])<<12)|ct_to_int(&cw[0]);
+
+    return ((((hard^res)>>12)&0x0FFF)&found)|(0xFFFF&~found);
+}
+
+/**
+ * @brief Pack four decoded Golay(24, 12) data words into a 6-byte LICH.
+ *
+ * @param outp An array of packed, decoded bits.
+ * @param v Four 12-bit values.
+ */
+static void pack_LICH(uint8_t outp[6], const uint16_t v[4])
+{
+    outp[0]=(v[0]>>4)&0xFF;
+    outp[1]=((v[0]&0xF)<<4)|((v[1]>>8)&0xF);
+    outp[2]=v[1]&0xFF;
+    outp[3]=(v[2]>>4)&0xFF;
+    outp[4]=((v[2]&0xF)<<4)|((v[3]>>8)&0xF);
+    outp[5]=v[3]&0xFF;
+}
+
+/**
+ * @brief Bit reversal table for 6-bit values.
+ *
+ */
+static const uint8_t rev6[64]=
+{
+    0x00, 0x20, 0x10, 0x30, 0x08, 0x28, 0x18, 0x38, 0x04, 0x24, 0x14, 0x34, 0x0C, 0x2C, 0x1C, 0x3C,
+    0x02, 0x22, 0x12, 0x32, 0x0A, 0x2A, 0x1A, 0x3A, 0x06, 0x26, 0x16, 0x36, 0x0E, 0x2E, 0x1E, 0x3E,
+    0x01, 0x21, 0x11, 0x31, 0x09, 0x29, 0x19, 0x39, 0x05, 0x25, 0x15, 0x35, 0x0D, 0x2D, 0x1D, 0x3D,
+    0x03, 0x23, 0x13, 0x33, 0x0B, 0x2B, 0x1B, 0x3B, 0x07, 0x27, 0x17, 0x37, 0x0F, 0x2F, 0x1F, 0x3F
+};
+
+/**
+ * @brief Take hard decisions and find marginal bits of the four LICH codewords.
+ * Bit j of each output word holds soft bit j of the codeword (M17 order, MSB first).
+ *
+ * @param hard Output - hard decisions of the four codewords.
+ * @param marg Output - marginal bit flags of the four codewords, see M17_GOLAY_HARD_MARGIN.
+ * @param inp Pointer to an array of 96 soft bits.
+ */
+static void lich_hard_bits(uint32_t hard[4], uint32_t marg[4], const uint16_t inp[96])
+{
+    uint64_t h[2]={0, 0}, m[2]={0, 0}; //96 bits each
+
+#ifdef __SSE2__
+    const __m128i bias=_mm_set1_epi16(M17_GOLAY_HARD_MARGIN);
+    const __m128i thr=_mm_set1_epi16((int16_t)(2*M17_GOLAY_HARD_MARGIN-0x8000));
+
+    for(uint8_t i=0; i<96; i+=16)
+    {
+        __m128i a=_mm_loadu_si128((const __m128i*)&inp[i]);
+        __m128i b=_mm_loadu_si128((const __m128i*)&inp[i+8]);
+
+        //sign bits are the hard decisions, signed saturation keeps them
+        uint64_t hv=(uint16_t)_mm_movemask_epi8(_mm_packs_epi16(a, b));
+        //v+margin below 2*margin (both offset by 0x8000 for a signed compare)
+        uint64_t mv=(uint16_t)_mm_movemask_epi8(_mm_packs_epi16(
+            _mm_cmplt_epi16(_mm_add_epi16(a, bias), thr),
+            _mm_cmplt_epi16(_mm_add_epi16(b, bias), thr)));
+
+        h[i/64]|=hv<<(i%64);
+        m[i/64]|=mv<<(i%64);
+    }
+#else
+    for(uint8_t i=0; i<96; i++)
+    {
+        h[i/64]|=(uint64_t)(inp[i]>>15)<<(i%64);
+        m[i/64]|=(uint64_t)((uint16_t)(inp[i]-(0x8000-M17_GOLAY_HARD_MARGIN))<2*M17_GOLAY_HARD_MARGIN)<<(i%64);
+    }
+#endif
+
+    hard[0]=h[0]&0xFFFFFF;
+    hard[1]=(h[0]>>24)&0xFFFFFF;
+    hard[2]=((h[0]>>48)|(h[1]<<16))&0xFFFFFF;
+    hard[3]=(h[1]>>8)&0xFFFFFF;
+    marg[0]=m[0]&0xFFFFFF;
+    marg[1]=(m[0]>>24)&0xFFFFFF;
+    marg[2]=((m[0]>>48)|(m[1]<<16))&0xFFFFFF;
+    marg[3]=(m[1]>>8)&0xFFFFFF;
+}
+
+/**
+ * @brief Decode the four LICH codewords from their hard decisions and marginal bits.
+ * Confident codewords are corrected with the syndrome table, the others go through golay24_sdecode().
+ *
+ * @param outp An array of packed, decoded bits.
+ * @param hard Hard decisions of the four codewords, from lich_hard_bits().
+ * @param marg Marginal bit flags of the four codewords, from lich_hard_bits().
+ * @param inp Pointer to an array of 96 soft bits.
+ */
+static void lich_decode_words(uint8_t outp[6], const uint32_t hard[4], const uint32_t marg[4], const uint16_t inp[96])
+{
+    uint16_t tmp[4];
+
+    for(uint8_t i=0; i<4; i++)
+    {
+        if(!marg[i])
+        {
+            uint16_t data=((uint16_t)rev6[hard[i]&0x3F]<<6)|rev6[(hard[i]>>6)&0x3F];
+            uint16_t parity=((uint16_t)rev6[(hard[i]>>12)&0x3F]<<6)|rev6[hard[i]>>18];
+            uint32_t e=golay_syndrome_table[(parity^golay24_encode(data))&0x0FFF];
+
+            if(e!=0xFFFFFFFFUL)
+            {
+                tmp[i]=(data^(e>>12))&0x0FFF;
+                continue;
+            }
+        }
+
+        tmp[i]=golay24_sdecode(&inp[i*24]);
+    }
+
+    pack_LICH(outp, tmp);
+}
+
 /**
  * @brief Soft decode LICH into a 6-byte array.
  *
@@ -241,22 +1135,147 @@ uint16_t golay24_sdecode(const uint16_t codeword[24])
  */
 void decode_LICH(uint8_t outp[6], const uint16_t inp[96])
 {
-    uint16_t tmp;
-
-    memset(outp, 0, 6);
-
-    tmp=golay24_sdecode(&inp[0]);
-    outp[0]=(tmp>>4)&0xFF;
-    outp[1]|=(tmp&0xF)<<4;
-    tmp=golay24_sdecode(&inp[1*24]);
-    outp[1]|=(tmp>>8)&0xF;
-    outp[2]=tmp&0xFF;
-    tmp=golay24_sdecode(&inp[2*24]);
-    outp[3]=(tmp>>4)&0xFF;
-    outp[4]|=(tmp&0xF)<<4;
-    tmp=golay24_sdecode(&inp[3*24]);
-    outp[4]|=(tmp>>8)&0xF;
-    outp[5]=tmp&0xFF;
+    decode_LICH_batch((uint8_t (*)[6])outp, inp, 96, 1);
+}
+
+/**
+ * @brief Soft decode the LICH of many frames at once.
+ * Hard decisions and marginal bits of all four codewords are extracted together,
+ * straight from the soft buffer, and confident codewords are corrected with
+ * the syndrome table. Only codewords with marginal bits go through golay24_sdecode().
+ * Results are identical to calling decode_LICH() for each frame.
+ *
+ * @param outp Array of n 6-byte arrays for the decoded bits.
+ * @param inp Pointer to the 96 soft bits of the first frame.
+ * @param stride Distance between the LICH soft bits of consecutive frames (elements).
+ * @param n Number of frames.
+ */
+void decode_LICH_batch(uint8_t outp[][6], const uint16_t* inp, uint16_t stride, uint16_t n)
+{
+    for(uint16_t f=0; f<n; f++)
+    {
+        const uint16_t* in=&inp[(size_t)f*stride];
+        uint32_t hard[4], marg[4];
+
+        lich_hard_bits(hard, marg, in);
+        lich_decode_words(outp[f], hard, marg, in);
+    }
+}
+
+/**
+ * @brief Initialize a LICH cache. Needs to be called at the start of every stream.
+ *
+ * @param cache Pointer to a LICH cache.
+ */
+void lich_cache_init(lich_cache_t* cache)
+{
+    memset(cache, 0, sizeof(lich_cache_t));
+}
+
+/**
+ * @brief Soft decode LICH into a 6-byte array, reusing earlier results of the same stream.
+ * If none of the 96 soft bits is marginal and their hard decisions match a cached entry,
+ * the cached result is returned without running the Golay decoder. Confident misses
+ * are decoded and cached. Results are identical to decode_LICH().
+ * A hit takes about a third of the time of decode_LICH(), a miss about the same.
+ *
+ * @param cache Pointer to the LICH cache of the stream.
+ * @param outp An array of packed, decoded bits.
+ * @param inp Pointer to an array of 96 soft bits.
+ */
+void decode_LICH_cached(lich_cache_t* cache, uint8_t outp[6], const uint16_t inp[96])
+{
+    uint32_t hard[4], marg[4];
+
+    lich_hard_bits(hard, marg, inp);
+
+    if(marg[0]|marg[1]|marg[2]|marg[3])
+    {
+        cache->misses++;
+        lich_decode_words(outp, hard, marg, inp);
+        return;
+    }
+
+    for(uint8_t i=0; i<cache->used; i++)
+    {
+        if(memcmp(cache->key[i], hard, sizeof(hard))==0)
+        {
+            cache->hits++;
+            memcpy(outp, cache->lich[i], 6);
+            return;
+        }
+    }
+
+    cache->misses++;
+    lich_decode_words(outp, hard, marg, inp);
+
+    memcpy(cache->key[cache->next], hard, sizeof(hard));
+    memcpy(cache->lich[cache->next], outp, 6);
+    cache->next=(cache->next+1)%M17_LICH_CACHE_SIZE;
+    if(cache->used<M17_LICH_CACHE_SIZE)
+        cache->used++;
+}
+
+/**
+ * @brief Maximum likelihood soft decode LICH into a 6-byte array.
+ *
+ * @param outp An array of packed, decoded bits.
+ * @param inp Pointer to an array of 96 soft bits.
+ * @return uint32_t Smallest decision margin of the four Golay codewords, see golay24_sdecode_ml().
+ */
+uint32_t decode_LICH_ml(uint8_t outp[6], const uint16_t inp[96])
+{
+    uint16_t tmp[4];
+    uint32_t margin, min_margin=UINT32_MAX;
+
+    for(uint8_t i=0; i<4; i++)
+    {
+        tmp[i]=golay24_sdecode_ml(&inp[i*24], &margin);
+        if(margin<min_margin)
+            min_margin=margin;
+    }
+
+    pack_LICH(outp, tmp);
+
+    return min_margin;
+}
+
+/**
+ * @brief Constant-time soft decode LICH into a 6-byte array.
+ *
+ * @param outp An array of packed, decoded bits.
+ * @param inp Pointer to an array of 96 soft bits.
+ */
+void decode_LICH_ct(uint8_t outp[6], const uint16_t inp[96])
+{
+    uint16_t tmp[4];
+
+    for(uint8_t i=0; i<4; i++)
+        tmp[i]=golay24_sdecode_ct(&inp[i*24]);
+
+    pack_LICH(outp, tmp);
+}
+
+/**
+ * @brief Soft decode LICH from int8 LLRs into a 6-byte array.
+ * LLRs are mapped onto the 16-bit soft bit scale, so the result is the same
+ * as with `decode_LICH()`.
+ *
+ * @param outp An array of packed, decoded bits.
+ * @param inp Pointer to an array of 96 LLR bits.
+ */
+void decode_LICH_llr(uint8_t outp[6], const int8_t inp[96])
+{
+    uint16_t soft[96];
+
+    for(uint8_t i=0; i<96; i++)
+    {
+        int16_t l = (inp[i] < -M17_LLR_MAX) ? -M17_LLR_MAX : inp[i];
+
+        soft[i]=(uint16_t)((l+M17_LLR_MAX)*258); //254*258=0xFFFC
+    }
+
+    decode_LICH(outp, soft);
 }
 
 void encode_LICH(uint8_t outp[12], const uint8_t inp[6])
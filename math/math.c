@@ -2,10 +2,12 @@
 // M17 C library - math/math.c
 //
 // This file contains:
-// - absolute difference value
 // - Euclidean norm (L2) calculation for n-dimensional vectors (float)
-// - soft-valued arrays to integer conversion (and vice-versa)
-// - fixed-valued multiplication and division
+// - soft-valued arrays to integer conversion (and vice-versa), SIMD where available
+// - fixed-valued division
+// - soft-valued array logic, SIMD where available
+// - masked int8 LLR negation, SIMD where available
+// - runtime CPU feature detection
 //
 // Wojciech Kaczmarski, SP5WWP
 // M17 Project, 25 January 2026
@@ -13,19 +15,35 @@
 #include <math.h>
 #include "m17.h"
 
-/**
- * @brief Utility function returning the absolute value of a difference between
- * two fixed-point values.
- *
- * @param v1 First value.
- * @param v2 Second value.
- * @return abs(v1-v2) value.
- */
-uint16_t q_abs_diff(uint16_t v1, uint16_t v2)
+#if defined(__SSE2__)
+#define M17_MATH_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define M17_MATH_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(M17_MATH_SSE2) || defined(M17_MATH_NEON)
+//lane weights for int <-> soft conversion, LSB first
+static const uint16_t soft_lsb_weights[16]=
 {
-    if(v2 > v1) return v2 - v1;
-    return v1 - v2;
-}
+	0x0001, 0x0002, 0x0004, 0x0008, 0x0010, 0x0020, 0x0040, 0x0080,
+	0x0100, 0x0200, 0x0400, 0x0800, 0x1000, 0x2000, 0x4000, 0x8000
+};
+
+//lane weights for packed masks, MSB first
+static const uint16_t soft_msb_weights[8]=
+{
+	0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01
+};
+
+//lane weights for packed masks of int8 lanes, MSB first, two mask bytes
+static const uint8_t llr_msb_weights[16]=
+{
+	0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+	0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01
+};
+#endif
 
 /**
  * @brief Calculate L2 norm between two n-dimensional vectors.
@@ -77,7 +95,24 @@ float sq_eucl_norm(const float* in1, const int8_t* in2, uint8_t n)
  */
 void int_to_soft(uint16_t* out, uint16_t in, uint8_t len)
 {
-	for(uint8_t i=0; i<len; i++)
+	uint8_t i=0;
+
+#if defined(M17_MATH_SSE2)
+	const __m128i v=_mm_set1_epi16((int16_t)in);
+
+	for(; i+8<=len && i+8<=16; i+=8)
+	{
+		__m128i w=_mm_loadu_si128((const __m128i*)&soft_lsb_weights[i]);
+		_mm_storeu_si128((__m128i*)&out[i], _mm_cmpeq_epi16(_mm_and_si128(v, w), w));
+	}
+#elif defined(M17_MATH_NEON)
+	const uint16x8_t v=vdupq_n_u16(in);
+
+	for(; i+8<=len && i+8<=16; i+=8)
+		vst1q_u16(&out[i], vtstq_u16(v, vld1q_u16(&soft_lsb_weights[i])));
+#endif
+
+	for(; i<len; i++)
 	{
 		out[i] = (in>>i)&1 ? 0xFFFF : 0;
 	}
@@ -93,8 +128,25 @@ void int_to_soft(uint16_t* out, uint16_t in, uint8_t len)
 uint16_t soft_to_int(const uint16_t* in, uint8_t len)
 {
 	uint16_t tmp=0;
+	uint8_t i=0;
+
+#if defined(M17_MATH_SSE2)
+	for(; i+8<=len && i+8<=16; i+=8)
+	{
+		__m128i v=_mm_loadu_si128((const __m128i*)&in[i]);
+		//signed saturation keeps the sign bits, which are the hard decisions
+		tmp|=(_mm_movemask_epi8(_mm_packs_epi16(v, v))&0xFF)<<i;
+	}
+#elif defined(M17_MATH_NEON)
+	for(; i+8<=len && i+8<=16; i+=8)
+	{
+		uint16x8_t m=vreinterpretq_u16_s16(vshrq_n_s16(vreinterpretq_s16_u16(vld1q_u16(&in[i])), 15));
+		uint64x2_t s=vpaddlq_u32(vpaddlq_u16(vandq_u16(m, vld1q_u16(&soft_lsb_weights[i]))));
+		tmp|=(uint16_t)(vgetq_lane_u64(s, 0)+vgetq_lane_u64(s, 1));
+	}
+#endif
 
-	for(uint8_t i=0; i<len; i++)
+	for(; i<len; i++)
 	{
 		if(in[i]>0x7FFFU)
 			tmp|=(1<<i);
@@ -103,35 +155,6 @@ uint16_t soft_to_int(const uint16_t* in, uint8_t len)
 	return tmp;
 }
 
-/**
- * @brief 1st quadrant fixed point addition with saturation.
- *
- * @param a Addend 1.
- * @param b Addend 2.
- * @return uint16_t Sum = a+b.
- */
-static uint16_t add16(uint16_t a, uint16_t b)
-{
-	uint32_t r=(uint32_t)a+b;
-	
-	return r<=0xFFFFU ? r : 0xFFFFU;
-}
-
-/**
- * @brief 1st quadrant fixed point subtraction with saturation.
- *
- * @param a Minuend.
- * @param b Subtrahent.
- * @return uint16_t Difference = a-b.
- */
-static uint16_t sub16(uint16_t a, uint16_t b)
-{	
-	if(a>=b)
-		return a-b;
-	else
-		return 0x0000U;
-}
-
 /**
  * @brief 1st quadrant fixed point division with saturation.
  *
@@ -147,54 +170,156 @@ uint16_t div16(uint16_t a, uint16_t b)
 	return r<=0xFFFFU ? r : 0xFFFFU;
 }
 
+//external definitions of the inline soft-logic helpers from m17.h, keeps them exported
+extern inline uint16_t q_abs_diff(uint16_t v1, uint16_t v2);
+extern inline uint16_t add16(uint16_t a, uint16_t b);
+extern inline uint16_t sub16(uint16_t a, uint16_t b);
+extern inline uint16_t mul16(uint16_t a, uint16_t b);
+extern inline uint16_t soft_bit_XOR(uint16_t a, uint16_t b);
+extern inline uint16_t soft_bit_NOT(uint16_t a);
+
 /**
- * @brief 1st quadrant fixed point multiplication.
- *
- * @param a Multiplicand.
- * @param b Multiplier.
- * @return uint16_t Product = a*b.
+ * @brief XOR for vectors of soft-valued logic.
+ * Max length is 255.
+ * @param out Output vector = A xor B.
+ * @param a Input vector A.
+ * @param b Input vector B.
+ * @param len Vectors' size.
  */
-uint16_t mul16(uint16_t a, uint16_t b)
+void soft_XOR(uint16_t* out, const uint16_t* a, const uint16_t* b, uint8_t len)
 {
-	return (uint16_t)(((uint32_t)a*b)>>16);
+	uint8_t i=0;
+
+#if defined(M17_MATH_SSE2)
+	const __m128i ones=_mm_set1_epi16(-1);
+
+	for(; i+8<=len; i+=8)
+	{
+		__m128i va=_mm_loadu_si128((const __m128i*)&a[i]);
+		__m128i vb=_mm_loadu_si128((const __m128i*)&b[i]);
+		__m128i r=_mm_adds_epu16(_mm_mulhi_epu16(va, _mm_xor_si128(vb, ones)),
+			_mm_mulhi_epu16(vb, _mm_xor_si128(va, ones)));
+		_mm_storeu_si128((__m128i*)&out[i], r);
+	}
+#elif defined(M17_MATH_NEON)
+	for(; i+8<=len; i+=8)
+	{
+		uint16x8_t va=vld1q_u16(&a[i]);
+		uint16x8_t vb=vld1q_u16(&b[i]);
+		uint16x8_t na=vmvnq_u16(va);
+		uint16x8_t nb=vmvnq_u16(vb);
+		uint16x8_t p=vcombine_u16(vshrn_n_u32(vmull_u16(vget_low_u16(va), vget_low_u16(nb)), 16),
+			vshrn_n_u32(vmull_u16(vget_high_u16(va), vget_high_u16(nb)), 16));
+		uint16x8_t q=vcombine_u16(vshrn_n_u32(vmull_u16(vget_low_u16(vb), vget_low_u16(na)), 16),
+			vshrn_n_u32(vmull_u16(vget_high_u16(vb), vget_high_u16(na)), 16));
+		vst1q_u16(&out[i], vqaddq_u16(p, q));
+	}
+#endif
+
+	for(; i<len; i++)
+		out[i]=soft_bit_XOR(a[i], b[i]);
 }
 
 /**
- * @brief Bilinear interpolation (soft-valued expansion) for XOR.
- * This approach retains XOR(0.5, 0.5)=0.5
- * https://math.stackexchange.com/questions/3505934/evaluation-of-not-and-xor-in-fuzzy-logic-rules
- * @param a Input A.
- * @param b Input B.
- * @return uint16_t Output = A xor B.
+ * @brief Soft logic NOT of the elements selected by a packed bit mask.
+ * Soft NOT is a XOR with 0xFFFF, so the mask bits are expanded
+ * to 16-bit lanes and applied with a single XOR.
+ *
+ * @param inp Input/output vector.
+ * @param mask Packed mask, MSB first. Elements with their bit set get inverted.
+ * @param len Vector's size.
  */
-uint16_t soft_bit_XOR(uint16_t a, uint16_t b)
+void soft_NOT_masked(uint16_t* inp, const uint8_t* mask, uint16_t len)
 {
-	//a(1-b)+b(1-a)
-	//return mul16(div16(0xFFFF-b, 0xFFFF), div16(a, 0xFFFF)) + mul16(div16(b, 0xFFFF), div16(0xFFFF-a, 0xFFFF));
-	return add16(mul16(a, sub16(0xFFFF, b)), mul16(b, sub16(0xFFFF, a)));
+	uint16_t i=0;
+
+#if defined(M17_MATH_SSE2)
+	const __m128i w=_mm_loadu_si128((const __m128i*)soft_msb_weights);
+
+	for(; i+8<=len; i+=8)
+	{
+		__m128i sel=_mm_cmpeq_epi16(_mm_and_si128(_mm_set1_epi16(mask[i/8]), w), w);
+		__m128i v=_mm_loadu_si128((const __m128i*)&inp[i]);
+		_mm_storeu_si128((__m128i*)&inp[i], _mm_xor_si128(v, sel));
+	}
+#elif defined(M17_MATH_NEON)
+	const uint16x8_t w=vld1q_u16(soft_msb_weights);
+
+	for(; i+8<=len; i+=8)
+	{
+		uint16x8_t sel=vtstq_u16(vdupq_n_u16(mask[i/8]), w);
+		vst1q_u16(&inp[i], veorq_u16(vld1q_u16(&inp[i]), sel));
+	}
+#endif
+
+	for(; i<len; i++)
+	{
+		if((mask[i/8]>>(7-(i%8)))&1)
+			inp[i]=soft_bit_NOT(inp[i]);
+	}
 }
 
 /**
- * @brief Soft logic NOT.
- * 
- * @param a Input A.
- * @return uint16_t Output = not A.
+ * @brief Negate the int8 LLRs selected by a packed bit mask.
+ * Negation is applied as (x^m)-m, with m expanded from the mask bits to 0 or -1.
+ * The subtraction saturates, so -128 (a certain 0) becomes +127 (a certain 1).
+ *
+ * @param inp Input/output vector.
+ * @param mask Packed mask, MSB first. Elements with their bit set get negated.
+ * @param len Vector's size.
  */
-uint16_t soft_bit_NOT(uint16_t a)
+void llr_NEG_masked(int8_t* inp, const uint8_t* mask, uint16_t len)
 {
-	return 0xFFFFU-a;
+	uint16_t i=0;
+
+#if defined(M17_MATH_SSE2)
+	const __m128i w=_mm_loadu_si128((const __m128i*)llr_msb_weights);
+
+	for(; i+16<=len; i+=16)
+	{
+		__m128i m=_mm_unpacklo_epi64(_mm_set1_epi8(mask[i/8]), _mm_set1_epi8(mask[i/8+1]));
+		__m128i sel=_mm_cmpeq_epi8(_mm_and_si128(m, w), w);
+		__m128i v=_mm_loadu_si128((const __m128i*)&inp[i]);
+		_mm_storeu_si128((__m128i*)&inp[i], _mm_subs_epi8(_mm_xor_si128(v, sel), sel));
+	}
+#elif defined(M17_MATH_NEON)
+	const uint8x16_t w=vld1q_u8(llr_msb_weights);
+
+	for(; i+16<=len; i+=16)
+	{
+		int8x16_t sel=vreinterpretq_s8_u8(vtstq_u8(vcombine_u8(vdup_n_u8(mask[i/8]), vdup_n_u8(mask[i/8+1])), w));
+		vst1q_s8(&inp[i], vqsubq_s8(veorq_s8(vld1q_s8(&inp[i]), sel), sel));
+	}
+#endif
+
+	for(; i<len; i++)
+	{
+		int8_t m=-(int8_t)((mask[i/8]>>(7-(i%8)))&1);
+		int16_t v=(int16_t)(inp[i]^m)-m;
+
+		inp[i]=v>M17_LLR_MAX ? M17_LLR_MAX : v;
+	}
 }
 
 /**
- * @brief XOR for vectors of soft-valued logic.
- * Max length is 255.
- * @param out Output vector = A xor B.
- * @param a Input vector A.
- * @param b Input vector B.
- * @param len Vectors' size.
+ * @brief Detect SIMD extensions available at runtime.
+ * Used to pick the fastest kernel for a given CPU.
+ *
+ * @return uint32_t Bitmask of M17_CPU_* flags.
  */
-void soft_XOR(uint16_t* out, const uint16_t* a, const uint16_t* b, uint8_t len)
+uint32_t m17_cpu_features(void)
 {
-	for(uint8_t i=0; i<len; i++)
-		out[i]=soft_bit_XOR(a[i], b[i]);
+	uint32_t flags=0;
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+	__builtin_cpu_init();
+	if(__builtin_cpu_supports("sse2"))
+		flags|=M17_CPU_SSE2;
+	if(__builtin_cpu_supports("avx2"))
+		flags|=M17_CPU_AVX2;
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	flags|=M17_CPU_NEON;
+#endif
+
+	return flags;
 }
@@ -55,3 +55,102 @@ uint16_t LSF_CRC(const lsf_t* in)
 
     return CRC_M17(d, 28);
 }
+
+/**
+ * @brief Calculate the CRC change caused by flipping a single bit.
+ * The CRC is affine in its input, so this is independent of the data.
+ *
+ * @param len Input's length.
+ * @param bit Bit position, MSB of in[0] first.
+ * @return uint16_t CRC difference.
+ */
+static uint16_t CRC_M17_bit_syndrome(uint16_t len, uint32_t bit)
+{
+	uint32_t crc=0x8000>>(bit%8);
+
+	for(uint32_t i=0; i<8*(len-bit/8); i++)
+	{
+		crc<<=1;
+		if(crc&0x10000)
+			crc=(crc^M17_CRC_POLY)&0xFFFF;
+	}
+
+	return crc;
+}
+
+/**
+ * @brief Chase-style error correction using the CRC.
+ * Tries combinations of flips of the least reliable bits until the CRC check
+ * passes. Every attempt costs a single XOR, as only one bit changes at a time.
+ * Note that each attempt also raises the chance of accepting a wrong message.
+ *
+ * @param in Data with the CRC appended, corrected in place.
+ * @param len Length in bytes, including the 2-byte CRC.
+ * @param rel Reliability of every bit of in, MSB of in[0] first. Lower is less reliable.
+ * @param budget Maximum number of flip patterns to try.
+ * @return int32_t Number of patterns tried before the check passed (0 if it passed as received),
+ *   -1 if the budget was used up - the data is left unchanged then.
+ */
+int32_t CRC_M17_chase(uint8_t* in, uint16_t len, const uint16_t* rel, uint16_t budget)
+{
+	uint16_t crc=CRC_M17(in, len);
+
+	if(crc==0)
+		return 0;
+
+	//as many bits as the budget can make use of
+	uint8_t n=0;
+	while(n<M17_CHASE_MAX_BITS && n<8*(uint32_t)len && ((1UL<<n)-1)<budget)
+		n++;
+
+	if(n==0)
+		return -1;
+
+	//find the n least reliable bits, sorted
+	uint32_t idx[M17_CHASE_MAX_BITS];
+	uint8_t cnt=0;
+
+	for(uint32_t b=0; b<8*(uint32_t)len; b++)
+	{
+		if(cnt==n && rel[b]>=rel[idx[n-1]])
+			continue;
+
+		uint8_t k=(cnt<n) ? cnt++ : n-1;
+		while(k>0 && rel[idx[k-1]]>rel[b])
+		{
+			idx[k]=idx[k-1];
+			k--;
+		}
+		idx[k]=b;
+	}
+
+	uint16_t syn[M17_CHASE_MAX_BITS];
+	for(uint8_t k=0; k<n; k++)
+		syn[k]=CRC_M17_bit_syndrome(len, idx[k]);
+
+	//Gray code order - the least reliable bits change most often
+	uint32_t pattern=0;
+
+	for(uint32_t t=1; t<=budget && t<(1UL<<n); t++)
+	{
+		uint8_t k=0;
+		while(!((t>>k)&1))
+			k++;
+
+		crc^=syn[k];
+		pattern^=1UL<<k;
+
+		if(crc==0)
+		{
+			for(k=0; k<n; k++)
+			{
+				if((pattern>>k)&1)
+					in[idx[k]/8]^=0x80>>(idx[k]%8);
+			}
+
+			return t;
+		}
+	}
+
+	return -1;
+}
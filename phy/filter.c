@@ -0,0 +1,524 @@
+//--------------------------------------------------------------------
+// M17 C library - phy/filter.c
+//
+// This file contains:
+// - streaming polyphase RRC interpolator (TX), SIMD where available
+// - streaming RRC matched filter and decimator (RX), SIMD where available
+// - symbol timing recovery (RX), max-energy phase selector
+//
+// agent <agent@local>
+// M17 Project, 16 October 2026
+//--------------------------------------------------------------------
+#include <string.h>
+#include <math.h>
+#include "m17.h"
+
+#if defined(__SSE2__)
+#define M17_FILTER_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define M17_FILTER_NEON
+#include <arm_neon.h>
+#endif
+
+/**
+ * @brief Initialize a polyphase RRC interpolator.
+ * Uses `rrc_taps_10_poly` for 48kHz and `rrc_taps_5_poly` for 24kHz output.
+ *
+ * @param ctx Pointer to an interpolator context.
+ * @param sps Samples per symbol: 10 (48kHz) or 5 (24kHz).
+ * @return int8_t 0 on success, -1 on unsupported samples per symbol value.
+ */
+int8_t rrc_interp_init(rrc_interp_t* ctx, uint8_t sps)
+{
+    const float* poly;
+
+    if(sps==10)
+        poly=rrc_taps_10_poly;
+    else if(sps==5)
+        poly=rrc_taps_5_poly;
+    else
+        return -1;
+
+    memset(ctx, 0, sizeof(rrc_interp_t));
+    ctx->sps=sps;
+
+    //transpose, so that all phases of a single tap are contiguous
+    for(uint8_t p=0; p<sps; p++)
+        for(uint8_t i=0; i<M17_RRC_PHASE_TAPS; i++)
+            ctx->taps[i][p]=poly[p*M17_RRC_PHASE_TAPS+i];
+
+    return 0;
+}
+
+/**
+ * @brief Clear the symbol history of an interpolator.
+ * The next output starts from silence, as after `rrc_interp_init()`.
+ *
+ * @param ctx Pointer to an interpolator context.
+ */
+void rrc_interp_reset(rrc_interp_t* ctx)
+{
+    memset(ctx->hist, 0, sizeof(ctx->hist));
+    ctx->pos=0;
+}
+
+/**
+ * @brief Push a single symbol and compute all of its output phases.
+ * Only the polyphase branches are evaluated, so none of the zero-stuffed
+ * samples of a plain upsample-and-convolve filter cost a multiply.
+ *
+ * @param ctx Pointer to an interpolator context.
+ * @param out Output: `sps` samples.
+ * @param x Symbol.
+ */
+static void interp_symbol(rrc_interp_t* ctx, float* out, float x)
+{
+    //newest symbol first, stored twice - the last 9 symbols are always contiguous
+    ctx->pos = ctx->pos ? ctx->pos-1 : M17_RRC_PHASE_TAPS-1;
+    ctx->hist[ctx->pos] = ctx->hist[ctx->pos+M17_RRC_PHASE_TAPS] = x;
+
+    const float* w = &ctx->hist[ctx->pos];
+
+#if defined(M17_FILTER_SSE2)
+    __m128 acc[M17_RRC_SPS_MAX/4];
+    float y[M17_RRC_SPS_MAX];
+
+    for(uint8_t v=0; v<M17_RRC_SPS_MAX/4; v++)
+        acc[v]=_mm_setzero_ps();
+
+    for(uint8_t i=0; i<M17_RRC_PHASE_TAPS; i++)
+    {
+        __m128 b=_mm_set1_ps(w[i]);
+
+        for(uint8_t v=0; v<M17_RRC_SPS_MAX/4; v++)
+            acc[v]=_mm_add_ps(acc[v], _mm_mul_ps(_mm_loadu_ps(&ctx->taps[i][4*v]), b));
+    }
+
+    for(uint8_t v=0; v<M17_RRC_SPS_MAX/4; v++)
+        _mm_storeu_ps(&y[4*v], acc[v]);
+
+    memcpy(out, y, ctx->sps*sizeof(float));
+#elif defined(M17_FILTER_NEON)
+    float32x4_t acc[M17_RRC_SPS_MAX/4];
+    float y[M17_RRC_SPS_MAX];
+
+    for(uint8_t v=0; v<M17_RRC_SPS_MAX/4; v++)
+        acc[v]=vdupq_n_f32(0);
+
+    for(uint8_t i=0; i<M17_RRC_PHASE_TAPS; i++)
+    {
+        for(uint8_t v=0; v<M17_RRC_SPS_MAX/4; v++)
+            acc[v]=vmlaq_n_f32(acc[v], vld1q_f32(&ctx->taps[i][4*v]), w[i]);
+    }
+
+    for(uint8_t v=0; v<M17_RRC_SPS_MAX/4; v++)
+        vst1q_f32(&y[4*v], acc[v]);
+
+    memcpy(out, y, ctx->sps*sizeof(float));
+#else
+    for(uint8_t p=0; p<ctx->sps; p++)
+    {
+        float y=0;
+
+        for(uint8_t i=0; i<M17_RRC_PHASE_TAPS; i++)
+            y+=ctx->taps[i][p]*w[i];
+
+        out[p]=y;
+    }
+#endif
+}
+
+/**
+ * @brief Interpolate symbols into RRC filtered baseband samples.
+ * The filter state carries over between calls, so consecutive blocks
+ * (e.g. frames) join without a seam. The output is delayed by the
+ * filter's group delay of 4 symbols.
+ *
+ * @param ctx Pointer to an interpolator context.
+ * @param out Output samples, `len*sps` floats.
+ * @param in Input symbols, {-3, -1, +1, +3}.
+ * @param len Number of input symbols.
+ * @return uint32_t Number of samples written.
+ */
+uint32_t rrc_interp(rrc_interp_t* ctx, float* out, const float* in, uint32_t len)
+{
+    for(uint32_t i=0; i<len; i++)
+        interp_symbol(ctx, &out[i*ctx->sps], in[i]);
+
+    return len*ctx->sps;
+}
+
+/**
+ * @brief Interpolate int8 symbols, as produced by `gen_frame_i8()`, into RRC filtered baseband samples.
+ * Same as `rrc_interp()`.
+ *
+ * @param ctx Pointer to an interpolator context.
+ * @param out Output samples, `len*sps` floats.
+ * @param in Input symbols, {-3, -1, +1, +3}.
+ * @param len Number of input symbols.
+ * @return uint32_t Number of samples written.
+ */
+uint32_t rrc_interp_i8(rrc_interp_t* ctx, float* out, const int8_t* in, uint32_t len)
+{
+    for(uint32_t i=0; i<len; i++)
+        interp_symbol(ctx, &out[i*ctx->sps], (float)in[i]);
+
+    return len*ctx->sps;
+}
+
+/**
+ * @brief Load matched filter taps: time reversed and padded to a multiple of 4 with leading zeros.
+ *
+ * @param taps Output: `M17_RRC_TAPS_MAX` floats.
+ * @param sps Samples per symbol: 10 (48kHz) or 5 (24kHz).
+ * @return uint8_t Number of taps, 0 on unsupported samples per symbol value.
+ */
+static uint8_t load_mf_taps(float* taps, uint8_t sps)
+{
+    const float* rrc;
+
+    if(sps==10)
+        rrc=rrc_taps_10;
+    else if(sps==5)
+        rrc=rrc_taps_5;
+    else
+        return 0;
+
+    uint8_t n=(8*sps+1+3)/4*4;
+
+    memset(taps, 0, M17_RRC_TAPS_MAX*sizeof(float));
+    for(uint8_t i=0; i<8*sps+1; i++)
+        taps[n-1-i]=rrc[i];
+
+    return n;
+}
+
+/**
+ * @brief Initialize an RRC matched filter and decimator.
+ * Uses `rrc_taps_10` for 48kHz and `rrc_taps_5` for 24kHz input.
+ * The taps have unit energy, so an `rrc_interp()` - `rrc_decim()` chain
+ * returns the original symbol values.
+ *
+ * @param ctx Pointer to a decimator context.
+ * @param sps Samples per symbol: 10 (48kHz) or 5 (24kHz).
+ * @param phase Index of the input sample, within each symbol period, taken as the symbol centre.
+ * @return int8_t 0 on success, -1 on invalid parameters.
+ */
+int8_t rrc_decim_init(rrc_decim_t* ctx, uint8_t sps, uint8_t phase)
+{
+    if((sps!=10 && sps!=5) || phase>=sps)
+        return -1;
+
+    memset(ctx, 0, sizeof(rrc_decim_t));
+    ctx->n_taps=load_mf_taps(ctx->taps, sps);
+    ctx->sps=sps;
+    ctx->phase=phase;
+    ctx->cnt=phase;
+
+    return 0;
+}
+
+/**
+ * @brief Clear the sample history of a decimator and restart its symbol clock.
+ *
+ * @param ctx Pointer to a decimator context.
+ */
+void rrc_decim_reset(rrc_decim_t* ctx)
+{
+    memset(ctx->buf, 0, sizeof(ctx->buf));
+    ctx->cnt=ctx->phase;
+}
+
+/**
+ * @brief Matched filter output at a single position.
+ *
+ * @param w Window of `n` samples, oldest first.
+ * @param taps Time reversed, zero padded taps.
+ * @param n Number of taps, a multiple of 4.
+ * @return float Filter output.
+ */
+static float decim_dot(const float* w, const float* taps, uint8_t n)
+{
+#if defined(M17_FILTER_SSE2)
+    __m128 acc0=_mm_setzero_ps(), acc1=_mm_setzero_ps();
+    uint8_t i=0;
+
+    for(; i+8<=n; i+=8)
+    {
+        acc0=_mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(&w[i]), _mm_loadu_ps(&taps[i])));
+        acc1=_mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(&w[i+4]), _mm_loadu_ps(&taps[i+4])));
+    }
+    if(i<n)
+        acc0=_mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(&w[i]), _mm_loadu_ps(&taps[i])));
+
+    acc0=_mm_add_ps(acc0, acc1);
+    acc0=_mm_add_ps(acc0, _mm_movehl_ps(acc0, acc0));
+    acc0=_mm_add_ss(acc0, _mm_shuffle_ps(acc0, acc0, 1));
+
+    return _mm_cvtss_f32(acc0);
+#elif defined(M17_FILTER_NEON)
+    float32x4_t acc=vdupq_n_f32(0);
+
+    for(uint8_t i=0; i<n; i+=4)
+        acc=vmlaq_f32(acc, vld1q_f32(&w[i]), vld1q_f32(&taps[i]));
+
+    float32x2_t t=vadd_f32(vget_low_f32(acc), vget_high_f32(acc));
+
+    return vget_lane_f32(vpadd_f32(t, t), 0);
+#else
+    float y=0;
+
+    for(uint8_t i=0; i<n; i++)
+        y+=w[i]*taps[i];
+
+    return y;
+#endif
+}
+
+/**
+ * @brief Matched filter and decimate baseband samples to symbols.
+ * Only the outputs at symbol centres are computed. The filter state and
+ * the symbol clock carry over between calls, so the input can be split into
+ * blocks of any size. Nothing is allocated - the input is processed in chunks
+ * of at most M17_RRC_DECIM_BLOCK samples through the context's buffer.
+ *
+ * @param ctx Pointer to a decimator context.
+ * @param out Output symbols, room for at least `len/sps+1` floats.
+ * @param in Input samples.
+ * @param len Number of input samples.
+ * @return uint32_t Number of symbols written.
+ */
+uint32_t rrc_decim(rrc_decim_t* ctx, float* out, const float* in, uint32_t len)
+{
+    const uint8_t hist=ctx->n_taps-1;   //samples kept from previous chunks
+    uint32_t k=0;
+
+    while(len)
+    {
+        uint16_t chunk=(len<M17_RRC_DECIM_BLOCK) ? len : M17_RRC_DECIM_BLOCK;
+
+        memcpy(&ctx->buf[hist], in, chunk*sizeof(float));
+
+        for(uint16_t j=0; j<chunk; j++)
+        {
+            if(ctx->cnt)
+            {
+                ctx->cnt--;
+                continue;
+            }
+
+            //window ending at the current sample
+            out[k++]=decim_dot(&ctx->buf[j], ctx->taps, ctx->n_taps);
+            ctx->cnt=ctx->sps-1;
+        }
+
+        memmove(ctx->buf, &ctx->buf[chunk], hist*sizeof(float));
+        in+=chunk;
+        len-=chunk;
+    }
+
+    return k;
+}
+
+/**
+ * @brief Matched filter output at every position of a chunk.
+ * Vectorized across outputs: each tap is broadcast and multiplied
+ * with 8 consecutive windows at once.
+ *
+ * @param y Output: `len` floats, rounded up to a multiple of 8.
+ * @param buf Sample history followed by the chunk. Must be readable up to
+ *   `len` rounded up to a multiple of 8, plus `n-1` floats.
+ * @param taps Time reversed, zero padded taps.
+ * @param n Number of taps.
+ * @param len Number of outputs.
+ */
+static void mf_block(float* y, const float* buf, const float* taps, uint8_t n, uint16_t len)
+{
+#if defined(M17_FILTER_SSE2)
+    for(uint16_t j=0; j<len; j+=8)
+    {
+        __m128 acc0=_mm_setzero_ps(), acc1=_mm_setzero_ps();
+
+        for(uint8_t i=0; i<n; i++)
+        {
+            __m128 t=_mm_set1_ps(taps[i]);
+
+            acc0=_mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(&buf[j+i]), t));
+            acc1=_mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(&buf[j+i+4]), t));
+        }
+
+        _mm_storeu_ps(&y[j], acc0);
+        _mm_storeu_ps(&y[j+4], acc1);
+    }
+#elif defined(M17_FILTER_NEON)
+    for(uint16_t j=0; j<len; j+=8)
+    {
+        float32x4_t acc0=vdupq_n_f32(0), acc1=vdupq_n_f32(0);
+
+        for(uint8_t i=0; i<n; i++)
+        {
+            acc0=vmlaq_n_f32(acc0, vld1q_f32(&buf[j+i]), taps[i]);
+            acc1=vmlaq_n_f32(acc1, vld1q_f32(&buf[j+i+4]), taps[i]);
+        }
+
+        vst1q_f32(&y[j], acc0);
+        vst1q_f32(&y[j+4], acc1);
+    }
+#else
+    for(uint16_t j=0; j<len; j++)
+    {
+        float acc=0;
+
+        for(uint8_t i=0; i<n; i++)
+            acc+=buf[j+i]*taps[i];
+
+        y[j]=acc;
+    }
+#endif
+}
+
+/**
+ * @brief Find the symbol centre from the per-phase energies.
+ * The energy curve over one symbol period is close to a raised cosine, so
+ * its first harmonic is fitted and the phase closest to its peak is returned.
+ * This is much less noisy than picking the single strongest phase,
+ * as all phases contribute to the estimate.
+ *
+ * @param ctx Pointer to a timing recovery context.
+ * @return uint8_t Symbol centre within a symbol period.
+ */
+static uint8_t sync_estimate(const symbol_sync_t* ctx)
+{
+    float c=0, s=0;
+
+    for(uint8_t p=0; p<ctx->sps; p++)
+    {
+        c+=ctx->energy[p]*ctx->cs[p];
+        s+=ctx->energy[p]*ctx->sn[p];
+    }
+
+    uint8_t best=0;
+    float max=c;
+
+    for(uint8_t p=1; p<ctx->sps; p++)
+    {
+        float v=c*ctx->cs[p]+s*ctx->sn[p];
+
+        if(v>max)
+        {
+            max=v;
+            best=p;
+        }
+    }
+
+    return best;
+}
+
+/**
+ * @brief Initialize symbol timing recovery.
+ * Uses `rrc_taps_10` for 48kHz and `rrc_taps_5` for 24kHz input.
+ *
+ * @param ctx Pointer to a timing recovery context.
+ * @param sps Samples per symbol: 10 (48kHz) or 5 (24kHz).
+ * @return int8_t 0 on success, -1 on unsupported samples per symbol value.
+ */
+int8_t symbol_sync_init(symbol_sync_t* ctx, uint8_t sps)
+{
+    if(sps!=10 && sps!=5)
+        return -1;
+
+    memset(ctx, 0, sizeof(symbol_sync_t));
+    ctx->n_taps=load_mf_taps(ctx->taps, sps);
+    ctx->sps=sps;
+    ctx->alpha=M17_SYNC_ALPHA;
+
+    for(uint8_t p=0; p<sps; p++)
+    {
+        ctx->cs[p]=cosf(6.2831853f*p/sps);
+        ctx->sn[p]=sinf(6.2831853f*p/sps);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Clear the sample history and the timing estimate, e.g. on a channel change.
+ * The smoothing factor is kept.
+ *
+ * @param ctx Pointer to a timing recovery context.
+ */
+void symbol_sync_reset(symbol_sync_t* ctx)
+{
+    memset(ctx->buf, 0, sizeof(ctx->buf));
+    memset(ctx->energy, 0, sizeof(ctx->energy));
+    ctx->phase=0;
+    ctx->idx=0;
+    ctx->cnt=0;
+}
+
+/**
+ * @brief Matched filter baseband samples and output symbols at the recovered timing.
+ * The matched filter is evaluated at every input sample and its output energy
+ * is averaged per phase. The peak of the energy curve is the timing estimate.
+ * After each symbol, the symbol clock moves by at most one sample towards it,
+ * along the shorter way, so a timing change never duplicates or skips a symbol. The output is ready for `slice_symbols()`
+ * and the frame decoders.
+ * State carries over between calls, the input can be split into blocks of any size.
+ *
+ * @param ctx Pointer to a timing recovery context.
+ * @param out Output symbols, room for at least `len/(sps-1)+1` floats.
+ * @param in Input samples.
+ * @param len Number of input samples.
+ * @return uint32_t Number of symbols written.
+ */
+uint32_t symbol_sync(symbol_sync_t* ctx, float* out, const float* in, uint32_t len)
+{
+    const uint8_t hist=ctx->n_taps-1;   //samples kept from previous chunks
+    uint32_t k=0;
+
+    while(len)
+    {
+        uint16_t chunk=(len<M17_RRC_DECIM_BLOCK) ? len : M17_RRC_DECIM_BLOCK;
+
+        memcpy(&ctx->buf[hist], in, chunk*sizeof(float));
+        mf_block(ctx->mf, ctx->buf, ctx->taps, ctx->n_taps, chunk);
+
+        for(uint16_t j=0; j<chunk; j++)
+        {
+            float y=ctx->mf[j];
+
+            //new symbol period - every phase has been updated equally often
+            if(ctx->idx==0)
+                ctx->phase=sync_estimate(ctx);
+
+            ctx->energy[ctx->idx]+=ctx->alpha*(y*y-ctx->energy[ctx->idx]);
+
+            if(ctx->cnt)
+                ctx->cnt--;
+            else
+            {
+                out[k++]=y;
+
+                //move the symbol clock towards the estimate, by at most one sample per symbol
+                uint8_t diff=(ctx->phase-ctx->idx+ctx->sps)%ctx->sps;
+
+                if(diff==0)
+                    ctx->cnt=ctx->sps-1;
+                else if(diff<=ctx->sps/2)
+                    ctx->cnt=ctx->sps;
+                else
+                    ctx->cnt=ctx->sps-2;
+            }
+
+            if(++ctx->idx==ctx->sps)
+                ctx->idx=0;
+        }
+
+        memmove(ctx->buf, &ctx->buf[chunk], hist*sizeof(float));
+        in+=chunk;
+        len-=chunk;
+    }
+
+    return k;
+}
@@ -57,3 +57,47 @@ void reorder_soft_bits(uint16_t outp[SYM_PER_PLD*2], const uint16_t inp[SYM_PER_
 	for(uint16_t i=0; i<SYM_PER_PLD*2; i++)
         outp[i]=inp[intrl_seq[i]];
 }
+
+/**
+ * @brief Reorder (interleave) 368 packed payload bits.
+ * The interleaver is the quadratic permutation polynomial (45*i+92*i^2) mod 368,
+ * for which intrl_seq[i+8]=intrl_seq[i]-8 (mod 368) and intrl_seq[k]%8=k for k<8.
+ * Bit k of output byte j is therefore bit k of input byte (intrl_seq[k]/8-j) mod 46,
+ * so every output byte is a masked OR of 8 input bytes - no per-bit work.
+ * 
+ * @param outp Reordered, packed bits (46 bytes).
+ * @param inp Input packed bits (46 bytes).
+ */
+void reorder_packed(uint8_t outp[SYM_PER_PLD*2/8], const uint8_t inp[SYM_PER_PLD*2/8])
+{
+    const uint8_t len=SYM_PER_PLD*2/8;
+    uint8_t rev[2*SYM_PER_PLD*2/8];     //rev[m]=rev[len+m]=inp[-m mod len]
+
+    rev[0]=rev[len]=inp[0];
+    for(uint8_t m=1; m<len; m++)
+        rev[m]=rev[len+m]=inp[len-m];
+
+    const uint8_t* src[8];
+
+    //inp[(b-j) mod len] = rev[len+j-b]
+    for(uint8_t k=0; k<8; k++)
+        src[k]=&rev[len-intrl_seq[k]/8];
+
+    for(uint8_t j=0; j<len; j++)
+    {
+        outp[j]=(src[0][j]&0x80)|(src[1][j]&0x40)|(src[2][j]&0x20)|(src[3][j]&0x10)
+            |(src[4][j]&0x08)|(src[5][j]&0x04)|(src[6][j]&0x02)|(src[7][j]&0x01);
+    }
+}
+
+/**
+ * @brief Reorder (interleave) 368 LLR bits.
+ *
+ * @param outp Reordered LLR bits.
+ * @param inp Input LLR bits.
+ */
+void reorder_llr(int8_t outp[SYM_PER_PLD*2], const int8_t inp[SYM_PER_PLD*2])
+{
+	for(uint16_t i=0; i<SYM_PER_PLD*2; i++)
+        outp[i]=inp[intrl_seq[i]];
+}
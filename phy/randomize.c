@@ -4,6 +4,7 @@
 // Wojciech Kaczmarski, SP5WWP
 // M17 Project, 29 December 2023
 //--------------------------------------------------------------------
+#include <string.h>
 #include "m17.h"
 
 //randomizing pattern
@@ -34,16 +35,46 @@ void randomize_bits(uint8_t inp[SYM_PER_PLD*2])
 
 /**
  * @brief Randomize type-4 soft bits.
+ * The randomizing pattern is applied as a XOR mask, 8 soft bits at a time where SIMD is available.
  * 
  * @param inp Input 368 soft type-4 bits.
  */
 void randomize_soft_bits(uint16_t inp[SYM_PER_PLD*2])
 {
-    for(uint16_t i=0; i<SYM_PER_PLD*2; i++)
+    soft_NOT_masked(inp, rand_seq, SYM_PER_PLD*2);
+}
+
+/**
+ * @brief Randomize packed type-4 bits.
+ * A plain XOR with `rand_seq`, 8 bytes at a time.
+ * 
+ * @param inp Input 368 packed type-4 bits (46 bytes).
+ */
+void randomize_packed(uint8_t inp[SYM_PER_PLD*2/8])
+{
+    uint8_t i=0;
+
+    for(; i+8<=SYM_PER_PLD*2/8; i+=8)
     {
-        if((rand_seq[i/8]>>(7-(i%8)))&1) //flip bit if '1'
-        {
-            inp[i]=soft_bit_NOT(inp[i]);
-        }
+        uint64_t a, b;
+
+        memcpy(&a, &inp[i], 8);
+        memcpy(&b, &rand_seq[i], 8);
+        a^=b;
+        memcpy(&inp[i], &a, 8);
     }
+
+    for(; i<SYM_PER_PLD*2/8; i++)
+        inp[i]^=rand_seq[i];
+}
+
+/**
+ * @brief Randomize type-4 LLR bits.
+ * Inverting an LLR is a sign flip.
+ * 
+ * @param inp Input 368 LLR type-4 bits.
+ */
+void randomize_llr(int8_t inp[SYM_PER_PLD*2])
+{
+    llr_NEG_masked(inp, rand_seq, SYM_PER_PLD*2);
 }
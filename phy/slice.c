@@ -6,6 +6,226 @@
 //-------------------------------
 #include "m17.h"
 
+#if defined(__SSE2__)
+#define M17_SLICE_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define M17_SLICE_NEON
+#include <arm_neon.h>
+#endif
+
+//destination of every sliced soft bit after deinterleaving (bits 8..0)
+//and its randomizer bit (bit 15), indexed by the soft bit's position in the type-4 stream
+static const uint16_t slice_dst_seq[SYM_PER_PLD*2]=
+{
+	0x8000, 0x8089, 0x005A, 0x80E3, 0x00B4, 0x813D, 0x810E, 0x0027, 0x8168, 0x0081, 0x8052, 0x80DB,
+	0x00AC, 0x8135, 0x0106, 0x801F, 0x8160, 0x8079, 0x804A, 0x00D3, 0x00A4, 0x012D, 0x80FE, 0x0017,
+	0x0158, 0x0071, 0x8042, 0x80CB, 0x009C, 0x0125, 0x00F6, 0x000F, 0x8150, 0x0069, 0x003A, 0x00C3,
+	0x0094, 0x011D, 0x80EE, 0x0007, 0x8148, 0x8061, 0x8032, 0x80BB, 0x808C, 0x8115, 0x80E6, 0x816F,
+	0x8140, 0x0059, 0x002A, 0x00B3, 0x0084, 0x810D, 0x00DE, 0x0167, 0x0138, 0x8051, 0x8022, 0x00AB,
+	0x007C, 0x0105, 0x80D6, 0x015F, 0x8130, 0x0049, 0x801A, 0x80A3, 0x8074, 0x00FD, 0x80CE, 0x0157,
+	0x0128, 0x8041, 0x0012, 0x009B, 0x806C, 0x80F5, 0x80C6, 0x014F, 0x8120, 0x0039, 0x000A, 0x8093,
+	0x0064, 0x80ED, 0x80BE, 0x0147, 0x8118, 0x0031, 0x0002, 0x808B, 0x005C, 0x00E5, 0x00B6, 0x013F,
+	0x8110, 0x8029, 0x016A, 0x8083, 0x8054, 0x00DD, 0x00AE, 0x0137, 0x8108, 0x0021, 0x0162, 0x807B,
+	0x804C, 0x00D5, 0x00A6, 0x012F, 0x8100, 0x8019, 0x015A, 0x8073, 0x8044, 0x80CD, 0x009E, 0x8127,
+	0x00F8, 0x8011, 0x0152, 0x806B, 0x803C, 0x80C5, 0x0096, 0x811F, 0x00F0, 0x0009, 0x014A, 0x0063,
+	0x8034, 0x80BD, 0x008E, 0x0117, 0x80E8, 0x8001, 0x0142, 0x005B, 0x802C, 0x00B5, 0x0086, 0x010F,
+	0x00E0, 0x8169, 0x013A, 0x8053, 0x0024, 0x00AD, 0x807E, 0x0107, 0x00D8, 0x8161, 0x0132, 0x004B,
+	0x001C, 0x00A5, 0x8076, 0x80FF, 0x80D0, 0x0159, 0x012A, 0x8043, 0x0014, 0x009D, 0x006E, 0x80F7,
+	0x00C8, 0x0151, 0x0122, 0x803B, 0x800C, 0x8095, 0x0066, 0x80EF, 0x80C0, 0x8149, 0x811A, 0x8033,
+	0x8004, 0x008D, 0x005E, 0x00E7, 0x00B8, 0x8141, 0x8112, 0x002B, 0x816C, 0x8085, 0x8056, 0x00DF,
+	0x00B0, 0x8139, 0x810A, 0x0023, 0x8164, 0x007D, 0x004E, 0x00D7, 0x00A8, 0x0131, 0x8102, 0x001B,
+	0x815C, 0x8075, 0x8046, 0x80CF, 0x00A0, 0x0129, 0x80FA, 0x8013, 0x0154, 0x806D, 0x003E, 0x80C7,
+	0x8098, 0x8121, 0x00F2, 0x800B, 0x814C, 0x0065, 0x8036, 0x00BF, 0x0090, 0x0119, 0x00EA, 0x8003,
+	0x0144, 0x805D, 0x002E, 0x00B7, 0x8088, 0x8111, 0x80E2, 0x016B, 0x813C, 0x0055, 0x8026, 0x00AF,
+	0x8080, 0x8109, 0x00DA, 0x0163, 0x8134, 0x804D, 0x001E, 0x80A7, 0x0078, 0x8101, 0x80D2, 0x815B,
+	0x012C, 0x8045, 0x8016, 0x009F, 0x0070, 0x00F9, 0x00CA, 0x8153, 0x8124, 0x003D, 0x000E, 0x8097,
+	0x8068, 0x00F1, 0x00C2, 0x014B, 0x811C, 0x8035, 0x0006, 0x808F, 0x8060, 0x80E9, 0x00BA, 0x8143,
+	0x0114, 0x802D, 0x016E, 0x8087, 0x8058, 0x00E1, 0x00B2, 0x013B, 0x010C, 0x0025, 0x0166, 0x007F,
+	0x8050, 0x80D9, 0x00AA, 0x8133, 0x0104, 0x001D, 0x015E, 0x8077, 0x0048, 0x00D1, 0x80A2, 0x812B,
+	0x00FC, 0x0015, 0x8156, 0x806F, 0x8040, 0x00C9, 0x009A, 0x0123, 0x00F4, 0x800D, 0x814E, 0x8067,
+	0x0038, 0x00C1, 0x0092, 0x811B, 0x00EC, 0x0005, 0x8146, 0x805F, 0x0030, 0x80B9, 0x008A, 0x8113,
+	0x00E4, 0x816D, 0x813E, 0x8057, 0x0028, 0x00B1, 0x0082, 0x810B, 0x80DC, 0x0165, 0x0136, 0x004F,
+	0x0020, 0x00A9, 0x807A, 0x0103, 0x80D4, 0x815D, 0x012E, 0x8047, 0x0018, 0x00A1, 0x8072, 0x00FB,
+	0x80CC, 0x0155, 0x0126, 0x803F, 0x0010, 0x8099, 0x806A, 0x80F3, 0x80C4, 0x014D, 0x011E, 0x0037,
+	0x8008, 0x8091, 0x0062, 0x00EB, 0x00BC, 0x0145, 0x8116, 0x802F
+};
+
+/**
+ * @brief Slicer coefficients, derived from `symbol_list`.
+ *
+ * @param k Output: 1/d32, 1/d21, 1/d10 (scaled to 0xFFFF) and the offsets of the outer segments.
+ */
+static void slice_coeffs(float k[5])
+{
+    k[0] = (float)0xFFFF / (symbol_list[3] - symbol_list[2]);
+    k[1] = (float)0xFFFF / (symbol_list[2] - symbol_list[1]);
+    k[2] = (float)0xFFFF / (symbol_list[1] - symbol_list[0]);
+    k[3] = -k[0] * symbol_list[2];
+    k[4] =  k[2] * symbol_list[1];
+}
+
+/**
+ * @brief Slice a single symbol into a soft dibit.
+ *
+ * @param d Output: bit 1, bit 0.
+ * @param x Symbol.
+ * @param k Coefficients from `slice_coeffs()`.
+ */
+static inline void slice_dibit(uint16_t d[2], const float x, const float k[5])
+{
+    /* bit 0 (d[1]) */
+    if (x >= symbol_list[3])
+    {
+        d[1] = 0xFFFF;
+    }
+    else if (x >= symbol_list[2])
+    {
+        d[1] = (uint16_t)(k[3] + x * k[0]);
+    }
+    else if (x >= symbol_list[1])
+    {
+        d[1] = 0x0000;
+    }
+    else if (x >= symbol_list[0])
+    {
+        d[1] = (uint16_t)(k[4] - x * k[2]);
+    }
+    else
+    {
+        d[1] = 0xFFFF;
+    }
+
+    /* bit 1 (d[0]) */
+    if (x >= symbol_list[2])
+    {
+        d[0] = 0x0000;
+    }
+    else if (x >= symbol_list[1])
+    {
+        d[0] = (uint16_t)(0x7FFF - x * k[1]);
+    }
+    else
+    {
+        d[0] = 0xFFFF;
+    }
+}
+
+#if defined(M17_SLICE_SSE2)
+/**
+ * @brief Branchless SSE2 slicer, 4 symbols.
+ * Computes every segment of the mapping and selects with compare masks,
+ * using the same float expressions as `slice_dibit()`, so the results are bit-exact.
+ *
+ * @param b1 Output: bit 1 of each symbol in the low 16 bits of a lane.
+ * @param b0 Output: bit 0 of each symbol in the low 16 bits of a lane.
+ * @param inp 4 symbols.
+ * @param k Coefficients from `slice_coeffs()`.
+ */
+static inline void slice_4_sse2(__m128i* b1, __m128i* b0, const float* inp, const float k[5])
+{
+    const __m128i ones = _mm_set1_epi32(0xFFFF);
+    const __m128 x = _mm_loadu_ps(inp);
+
+    __m128i m0 = _mm_castps_si128(_mm_cmpge_ps(x, _mm_set1_ps(symbol_list[0])));
+    __m128i m1 = _mm_castps_si128(_mm_cmpge_ps(x, _mm_set1_ps(symbol_list[1])));
+    __m128i m2 = _mm_castps_si128(_mm_cmpge_ps(x, _mm_set1_ps(symbol_list[2])));
+    __m128i m3 = _mm_castps_si128(_mm_cmpge_ps(x, _mm_set1_ps(symbol_list[3])));
+
+    __m128i a = _mm_cvttps_epi32(_mm_add_ps(_mm_set1_ps(k[3]), _mm_mul_ps(x, _mm_set1_ps(k[0]))));
+    __m128i b = _mm_cvttps_epi32(_mm_sub_ps(_mm_set1_ps(k[4]), _mm_mul_ps(x, _mm_set1_ps(k[2]))));
+    __m128i c = _mm_cvttps_epi32(_mm_sub_ps(_mm_set1_ps((float)0x7FFF), _mm_mul_ps(x, _mm_set1_ps(k[1]))));
+
+    //bit 0: 0xFFFF outside [s0, s3), rising segment in [s2, s3), falling one in [s0, s1)
+    *b0 = _mm_or_si128(_mm_and_si128(_mm_or_si128(m3, _mm_andnot_si128(m0, ones)), ones),
+        _mm_or_si128(_mm_and_si128(_mm_andnot_si128(m3, m2), a), _mm_and_si128(_mm_andnot_si128(m1, m0), b)));
+
+    //bit 1: 0xFFFF below s1, falling segment in [s1, s2)
+    *b1 = _mm_or_si128(_mm_andnot_si128(m1, ones), _mm_and_si128(_mm_andnot_si128(m2, m1), c));
+}
+
+/**
+ * @brief Pack the low 16 bits of the lanes of two vectors.
+ */
+static inline __m128i pack_lo16_sse2(__m128i lo, __m128i hi)
+{
+    //sign extend the low halves, so that the signed saturation keeps them intact
+    lo = _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16);
+    hi = _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16);
+
+    return _mm_packs_epi32(lo, hi);
+}
+#endif
+
+/**
+ * @brief Slice symbols into soft dibits, 8 at a time where SIMD is available.
+ *
+ * @param out Soft valued dibits.
+ * @param inp Symbols.
+ * @param len Number of symbols.
+ * @param k Coefficients from `slice_coeffs()`.
+ */
+static void slice_block(uint16_t* out, const float* inp, uint_fast16_t len, const float k[5])
+{
+    uint_fast16_t i = 0;
+
+#if defined(M17_SLICE_SSE2)
+    for (; i + 8 <= len; i += 8)
+    {
+        __m128i b1l, b0l, b1h, b0h;
+
+        slice_4_sse2(&b1l, &b0l, &inp[i], k);
+        slice_4_sse2(&b1h, &b0h, &inp[i+4], k);
+
+        __m128i b1 = pack_lo16_sse2(b1l, b1h);
+        __m128i b0 = pack_lo16_sse2(b0l, b0h);
+
+        _mm_storeu_si128((__m128i*)&out[i*2], _mm_unpacklo_epi16(b1, b0));
+        _mm_storeu_si128((__m128i*)&out[i*2+8], _mm_unpackhi_epi16(b1, b0));
+    }
+#elif defined(M17_SLICE_NEON)
+    const float32x4_t s0 = vdupq_n_f32(symbol_list[0]);
+    const float32x4_t s1 = vdupq_n_f32(symbol_list[1]);
+    const float32x4_t s2 = vdupq_n_f32(symbol_list[2]);
+    const float32x4_t s3 = vdupq_n_f32(symbol_list[3]);
+    const uint16x8_t ones = vdupq_n_u16(0xFFFF);
+    const uint16x8_t zeros = vdupq_n_u16(0);
+
+    for (; i + 8 <= len; i += 8)
+    {
+        float32x4_t x[2] = {vld1q_f32(&inp[i]), vld1q_f32(&inp[i+4])};
+        uint16x8_t m[4], a, b, c;
+        uint16x4_t t[2][3];
+
+        for (uint8_t h = 0; h < 2; h++)
+        {
+            t[h][0] = vmovn_u32(vreinterpretq_u32_s32(vcvtq_s32_f32(vaddq_f32(vdupq_n_f32(k[3]), vmulq_f32(x[h], vdupq_n_f32(k[0]))))));
+            t[h][1] = vmovn_u32(vreinterpretq_u32_s32(vcvtq_s32_f32(vsubq_f32(vdupq_n_f32(k[4]), vmulq_f32(x[h], vdupq_n_f32(k[2]))))));
+            t[h][2] = vmovn_u32(vreinterpretq_u32_s32(vcvtq_s32_f32(vsubq_f32(vdupq_n_f32((float)0x7FFF), vmulq_f32(x[h], vdupq_n_f32(k[1]))))));
+        }
+
+        a = vcombine_u16(t[0][0], t[1][0]);
+        b = vcombine_u16(t[0][1], t[1][1]);
+        c = vcombine_u16(t[0][2], t[1][2]);
+
+        m[0] = vcombine_u16(vmovn_u32(vcgeq_f32(x[0], s0)), vmovn_u32(vcgeq_f32(x[1], s0)));
+        m[1] = vcombine_u16(vmovn_u32(vcgeq_f32(x[0], s1)), vmovn_u32(vcgeq_f32(x[1], s1)));
+        m[2] = vcombine_u16(vmovn_u32(vcgeq_f32(x[0], s2)), vmovn_u32(vcgeq_f32(x[1], s2)));
+        m[3] = vcombine_u16(vmovn_u32(vcgeq_f32(x[0], s3)), vmovn_u32(vcgeq_f32(x[1], s3)));
+
+        uint16x8x2_t d;
+
+        d.val[1] = vbslq_u16(m[3], ones, vbslq_u16(m[2], a, vbslq_u16(m[1], zeros, vbslq_u16(m[0], b, ones))));
+        d.val[0] = vbslq_u16(m[2], zeros, vbslq_u16(m[1], c, ones));
+
+        vst2q_u16(&out[i*2], d);
+    }
+#endif
+
+    for (; i < len; i++)
+        slice_dibit(&out[i*2], inp[i], k);
+}
+
 /**
  * @brief Slice payload symbols into soft dibits.
  * Input (RRC filtered baseband sampled at symbol centers)
@@ -15,12 +235,55 @@
  */
 void slice_symbols(uint16_t out[2*SYM_PER_PLD], const float inp[SYM_PER_PLD])
 {
-    const float inv_d32 = (float)0xFFFF / (symbol_list[3] - symbol_list[2]);
-    const float inv_d21 = (float)0xFFFF / (symbol_list[2] - symbol_list[1]);
-    const float inv_d10 = (float)0xFFFF / (symbol_list[1] - symbol_list[0]);
+    float k[5];
+
+    slice_coeffs(k);
+    slice_block(out, inp, SYM_PER_PLD, k);
+}
+
+/**
+ * @brief Slice, derandomize and deinterleave payload symbols in one pass.
+ * Same result as `slice_symbols()`, `randomize_soft_bits()` and `reorder_soft_bits()`
+ * in a row, without the intermediate buffer. Every soft bit is written straight
+ * to its deinterleaved position, inverted if its randomizer bit is set.
+ * @param out Soft valued, derandomized and deinterleaved bits (type-2/3).
+ * @param inp Array of 184 floats (1 sample per symbol).
+ */
+void slice_symbols_fused(uint16_t out[2*SYM_PER_PLD], const float inp[SYM_PER_PLD])
+{
+    float k[5];
+
+    slice_coeffs(k);
+
+    //slice 8 symbols at a time, then scatter the 16 soft bits
+    for (uint_fast16_t i = 0; i < SYM_PER_PLD; i += 8)
+    {
+        uint16_t d[16];
+        uint_fast16_t n = (SYM_PER_PLD - i < 8) ? SYM_PER_PLD - i : 8;
 
-    const float c3 = -inv_d32 * symbol_list[2];
-    const float c1 =  inv_d10 * symbol_list[1];
+        slice_block(d, &inp[i], n, k);
+
+        for (uint_fast8_t j = 0; j < n*2; j++)
+        {
+            const uint16_t e = slice_dst_seq[i*2+j];
+
+            out[e & 0x1FF] = d[j] ^ (uint16_t)-(e >> 15);
+        }
+    }
+}
+
+/**
+ * @brief Slice payload symbols into int8 LLR dibits.
+ * Same piecewise linear mapping as `slice_symbols()`, scaled to
+ * -M17_LLR_MAX (certain 0) .. +M17_LLR_MAX (certain 1).
+ * @param out LLR valued dibits (type-4).
+ * @param inp Array of 184 floats (1 sample per symbol).
+ */
+void slice_symbols_llr(int8_t out[2*SYM_PER_PLD], const float inp[SYM_PER_PLD])
+{
+    const float k32 = 2.0f * M17_LLR_MAX / (symbol_list[3] - symbol_list[2]);
+    const float k21 = 2.0f * M17_LLR_MAX / (symbol_list[2] - symbol_list[1]);
+    const float k10 = 2.0f * M17_LLR_MAX / (symbol_list[1] - symbol_list[0]);
 
     for (uint_fast8_t i = 0; i < SYM_PER_PLD; i++)
     {
@@ -29,37 +292,37 @@ void slice_symbols(uint16_t out[2*SYM_PER_PLD], const float inp[SYM_PER_PLD])
         /* bit 0 (out[i*2+1]) */
         if (x >= symbol_list[3])
         {
-            out[i*2+1] = 0xFFFF;
+            out[i*2+1] = M17_LLR_MAX;
         }
         else if (x >= symbol_list[2])
         {
-            out[i*2+1] = (uint16_t)(c3 + x * inv_d32);
+            out[i*2+1] = (int8_t)(-M17_LLR_MAX + (x - symbol_list[2]) * k32);
         }
         else if (x >= symbol_list[1])
         {
-            out[i*2+1] = 0x0000;
+            out[i*2+1] = -M17_LLR_MAX;
         }
         else if (x >= symbol_list[0])
         {
-            out[i*2+1] = (uint16_t)(c1 - x * inv_d10);
+            out[i*2+1] = (int8_t)(M17_LLR_MAX - (x - symbol_list[0]) * k10);
         }
         else
         {
-            out[i*2+1] = 0xFFFF;
+            out[i*2+1] = M17_LLR_MAX;
         }
 
         /* bit 1 (out[i*2]) */
         if (x >= symbol_list[2])
         {
-            out[i*2] = 0x0000;
+            out[i*2] = -M17_LLR_MAX;
         }
         else if (x >= symbol_list[1])
         {
-            out[i*2] = (uint16_t)(0x7FFF - x * inv_d21);
+            out[i*2] = (int8_t)(M17_LLR_MAX - (x - symbol_list[1]) * k21);
         }
         else
         {
-            out[i*2] = 0xFFFF;
+            out[i*2] = M17_LLR_MAX;
         }
     }
 }
@@ -84,6 +84,80 @@ void soft_logic_xor(void)
     TEST_ASSERT_EQUAL(0x0000, soft_bit_XOR(0xFFFF, 0xFFFF));
 }
 
+void soft_logic_arrays(void)
+{
+    uint16_t a[37], b[37], out[37], ref[37];
+    uint8_t mask[5];
+
+    for(uint8_t i=0; i<37; i++)
+    {
+        a[i]=rand()%0x10000;
+        b[i]=rand()%0x10000;
+    }
+    for(uint8_t i=0; i<5; i++)
+        mask[i]=rand()%256;
+
+    //array versions have to match the scalar helpers, including the tails
+    soft_XOR(out, a, b, 37);
+    for(uint8_t i=0; i<37; i++)
+        TEST_ASSERT_EQUAL_UINT16(soft_bit_XOR(a[i], b[i]), out[i]);
+
+    memcpy(out, a, sizeof(a));
+    soft_NOT_masked(out, mask, 37);
+    for(uint8_t i=0; i<37; i++)
+        TEST_ASSERT_EQUAL_UINT16(((mask[i/8]>>(7-i%8))&1) ? soft_bit_NOT(a[i]) : a[i], out[i]);
+
+    for(uint8_t len=1; len<=16; len++)
+    {
+        uint16_t v=rand()%0x10000;
+
+        int_to_soft(out, v, len);
+        for(uint8_t i=0; i<len; i++)
+            TEST_ASSERT_EQUAL_UINT16(((v>>i)&1)*0xFFFF, out[i]);
+
+        for(uint8_t i=0; i<len; i++)
+            ref[i]=rand()%0x10000;
+        v=0;
+        for(uint8_t i=0; i<len; i++)
+            v|=(ref[i]>0x7FFF)<<i;
+        TEST_ASSERT_EQUAL_UINT16(v, soft_to_int(ref, len));
+    }
+
+    //lengths past 16 do not read beyond the SIMD weight tables
+    int_to_soft(out, 0xA5C3, 24);
+    for(uint8_t i=0; i<16; i++)
+        TEST_ASSERT_EQUAL_UINT16(((0xA5C3>>i)&1)*0xFFFF, out[i]);
+    for(uint8_t i=16; i<24; i++)
+        TEST_ASSERT_EQUAL_UINT16(0, out[i]);
+    TEST_ASSERT_EQUAL_UINT16(0xA5C3, soft_to_int(out, 24));
+}
+
+void llr_negation(void)
+{
+    int8_t llr[37], out[37];
+    uint8_t mask[5];
+
+    for(uint8_t i=0; i<37; i++)
+        llr[i]=rand()%256-128;
+    for(uint8_t i=0; i<5; i++)
+        mask[i]=rand()%256;
+    llr[3]=llr[20]=llr[36]=-128; //certain 0s, in the SIMD part and the tail
+    mask[0]|=0x10;
+    mask[2]|=0x08;
+    mask[4]|=0x08;
+
+    //negation saturates, a flipped certain 0 is a certain 1
+    memcpy(out, llr, sizeof(llr));
+    llr_NEG_masked(out, mask, 37);
+    for(uint8_t i=0; i<37; i++)
+    {
+        int16_t ref=((mask[i/8]>>(7-i%8))&1) ? -llr[i] : llr[i];
+        TEST_ASSERT_EQUAL_INT8(ref>M17_LLR_MAX ? M17_LLR_MAX : ref, out[i]);
+    }
+    TEST_ASSERT_EQUAL_INT8(M17_LLR_MAX, out[20]);
+    TEST_ASSERT_EQUAL_INT8(M17_LLR_MAX, out[36]);
+}
+
 void fill_symbols_from_table(float *symbols)
 {
     const size_t n = sizeof(slice_cases) / sizeof(slice_cases[0]);
@@ -119,6 +193,72 @@ void symbol_to_dibit(void)
     }
 }
 
+/**
+ * @brief Reference slicer - the plain if/else mapping, one symbol at a time.
+ */
+static void slice_reference(uint16_t d[2], float x)
+{
+    const float inv_d32 = (float)0xFFFF / (symbol_list[3] - symbol_list[2]);
+    const float inv_d21 = (float)0xFFFF / (symbol_list[2] - symbol_list[1]);
+    const float inv_d10 = (float)0xFFFF / (symbol_list[1] - symbol_list[0]);
+    const float c3 = -inv_d32 * symbol_list[2];
+    const float c1 =  inv_d10 * symbol_list[1];
+
+    if (x >= symbol_list[3])        d[1] = 0xFFFF;
+    else if (x >= symbol_list[2])   d[1] = (uint16_t)(c3 + x * inv_d32);
+    else if (x >= symbol_list[1])   d[1] = 0x0000;
+    else if (x >= symbol_list[0])   d[1] = (uint16_t)(c1 - x * inv_d10);
+    else                            d[1] = 0xFFFF;
+
+    if (x >= symbol_list[2])        d[0] = 0x0000;
+    else if (x >= symbol_list[1])   d[0] = (uint16_t)(0x7FFF - x * inv_d21);
+    else                            d[0] = 0xFFFF;
+}
+
+void symbol_to_dibit_exact(void)
+{
+    float symbols[SYM_PER_PLD];
+    uint16_t soft[2*SYM_PER_PLD], ref[2];
+
+    for (int j = 0; j < 20; j++)
+    {
+        // segment boundaries, their neighbours and random values
+        for (int i = 0; i < SYM_PER_PLD; i++)
+        {
+            if (j == 0)
+                symbols[i] = symbol_list[i % 4] + (i / 4 % 3 - 1) * 1e-6f;
+            else
+                symbols[i] = ((float)rand() / RAND_MAX - 0.5f) * 10.0f;
+        }
+
+        slice_symbols(soft, symbols);
+
+        for (int i = 0; i < SYM_PER_PLD; i++)
+        {
+            slice_reference(ref, symbols[i]);
+            TEST_ASSERT_EQUAL_UINT16_ARRAY(ref, &soft[2*i], 2);
+        }
+    }
+}
+
+void symbol_to_dibit_fused(void)
+{
+    float symbols[SYM_PER_PLD];
+    uint16_t soft[2*SYM_PER_PLD], ref[2*SYM_PER_PLD], fused[2*SYM_PER_PLD];
+
+    fill_symbols_from_table(symbols);
+    for (int i = 0; i < SYM_PER_PLD; i += 3)
+        symbols[i] = ((float)rand() / RAND_MAX - 0.5f) * 8.0f;
+
+    slice_symbols(soft, symbols);
+    randomize_soft_bits(soft);
+    reorder_soft_bits(ref, soft);
+
+    slice_symbols_fused(fused, symbols);
+
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(ref, fused, 2*SYM_PER_PLD);
+}
+
 /**
  * @brief Apply errors to a soft-valued 24-bit logic vector.
  * Errors are spread out evenly among num_errs bits.
@@ -763,6 +903,218 @@ void golay_soft_decode_flipped_5(void)
     }
 }
 
+void golay_hard_decode_table(void)
+{
+    uint16_t vector[24]; //soft-logic 24-bit vector
+
+    //every pattern of up to 3 flipped bits must be corrected by the syndrome table
+    for(uint8_t a=0; a<=24; a++)
+    {
+        for(uint8_t b=a; b<=24; b++)
+        {
+            for(uint8_t c=b; c<=24; c++)
+            {
+                uint16_t data=rand()%0x1000;
+                uint32_t cw=golay24_encode(data)^(((1UL<<a)|(1UL<<b)|(1UL<<c))&0xFFFFFF);
+
+                for(uint8_t i=0; i<24; i++)
+                    vector[23-i]=((cw>>i)&1)*0xFFFF;
+
+                TEST_ASSERT_EQUAL(data, golay24_sdecode(vector));
+            }
+        }
+    }
+}
+
+void golay_soft_decode_confident_3(void)
+{
+    uint16_t vector[24]; //soft-logic 24-bit vector
+
+    //D78|80F with bits 3, 6 and 16 flipped at full confidence, the correct bits
+    //just outside M17_GOLAY_HARD_MARGIN - the soft search alone gives up on this one
+    const uint32_t cw=0x0D7880F^(1UL<<3)^(1UL<<6)^(1UL<<16);
+
+    for(uint8_t i=0; i<24; i++)
+    {
+        uint8_t flipped=(i==3 || i==6 || i==16);
+
+        if((cw>>i)&1)
+            vector[23-i]=flipped ? 0xFFFF : 0xC000;
+        else
+            vector[23-i]=flipped ? 0x0000 : 0x3FFF;
+    }
+
+    TEST_ASSERT_EQUAL(0x0D78, golay24_sdecode(vector));
+}
+
+void golay_ml_decode(void)
+{
+    uint16_t vector[24]; //soft-logic 24-bit vector
+    uint32_t margin;
+
+    for(uint16_t j=0; j<200; j++)
+    {
+        uint16_t data=rand()%0x1000;
+        uint32_t cw=golay24_encode(data);
+
+        //heavy soft noise
+        for(uint8_t i=0; i<24; i++)
+        {
+            int32_t v=((cw>>i)&1)*0xFFFF+(rand()%0x10000)-0x8000;
+            vector[23-i]=v<0 ? 0 : (v>0xFFFF ? 0xFFFF : v);
+        }
+
+        //brute force search for the codeword at the lowest soft distance
+        uint64_t best=UINT64_MAX;
+        uint16_t best_data=0;
+        for(uint16_t d=0; d<0x1000; d++)
+        {
+            uint32_t c=golay24_encode(d);
+            uint64_t dist=0;
+            for(uint8_t i=0; i<24; i++)
+                dist+=((c>>i)&1) ? 0xFFFF-vector[23-i] : vector[23-i];
+            if(dist<best)
+            {
+                best=dist;
+                best_data=d;
+            }
+        }
+
+        TEST_ASSERT_EQUAL(best_data, golay24_sdecode_ml(vector, &margin));
+    }
+
+    //clean codeword - the runner-up is 8 bits away
+    for(uint8_t i=0; i<24; i++)
+        vector[23-i]=((0x0D7880F>>i)&1)*0xFFFF;
+    TEST_ASSERT_EQUAL(0x0D78, golay24_sdecode_ml(vector, &margin));
+    TEST_ASSERT_EQUAL(8*0xFFFF, margin);
+
+    //LICH
+    uint8_t lich[6], lich_enc[12], lich_dec[6];
+    uint16_t soft[96];
+    for(uint8_t i=0; i<6; i++)
+        lich[i]=rand()%256;
+    encode_LICH(lich_enc, lich);
+    for(uint8_t i=0; i<96; i++)
+        soft[i]=((lich_enc[i/8]>>(7-i%8))&1)*0xFFFF;
+    soft[5]=0xFFFF-soft[5];
+    TEST_ASSERT_EQUAL(6*0xFFFF, decode_LICH_ml(lich_dec, soft));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(lich, lich_dec, 6);
+}
+
+void golay_ct_decode(void)
+{
+    uint16_t vector[24]; //soft-logic 24-bit vector
+
+    //the constant-time decoder must match the soft search bit for bit
+    for(uint16_t j=0; j<2000; j++)
+    {
+        uint32_t cw=golay24_encode(rand()%0x1000);
+
+        for(uint8_t i=0; i<24; i++)
+        {
+            int32_t v=((cw>>i)&1)*0xFFFF+(rand()%0x14000)-0xA000;
+            vector[23-i]=v<0 ? 0 : (v>0xFFFF ? 0xFFFF : v);
+        }
+        vector[rand()%24]=0x7FFF; //marginal bit, forces the soft search
+
+        TEST_ASSERT_EQUAL(golay24_sdecode(vector), golay24_sdecode_ct(vector));
+    }
+}
+
+void lich_decode_batch(void)
+{
+    uint16_t soft[4][100]; //padded stride
+    uint8_t out[4][6], ref[6];
+
+    for(uint16_t j=0; j<200; j++)
+    {
+        for(uint8_t f=0; f<4; f++)
+        {
+            uint8_t lich[6], lich_enc[12];
+
+            for(uint8_t i=0; i<6; i++)
+                lich[i]=rand()%256;
+            encode_LICH(lich_enc, lich);
+
+            //mix of confident and marginal bits, some flipped
+            for(uint8_t i=0; i<96; i++)
+            {
+                int32_t v=((lich_enc[i/8]>>(7-i%8))&1)*0xFFFF+(rand()%0x14000)-0xA000;
+                soft[f][i]=v<0 ? 0 : (v>0xFFFF ? 0xFFFF : v);
+            }
+        }
+
+        decode_LICH_batch(out, soft[0], 100, 4);
+
+        for(uint8_t f=0; f<4; f++)
+        {
+            uint16_t v[4];
+
+            for(uint8_t i=0; i<4; i++)
+                v[i]=golay24_sdecode(&soft[f][i*24]);
+
+            ref[0]=(v[0]>>4)&0xFF;
+            ref[1]=((v[0]&0xF)<<4)|((v[1]>>8)&0xF);
+            ref[2]=v[1]&0xFF;
+            ref[3]=(v[2]>>4)&0xFF;
+            ref[4]=((v[2]&0xF)<<4)|((v[3]>>8)&0xF);
+            ref[5]=v[3]&0xFF;
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(ref, out[f], 6);
+        }
+    }
+}
+
+void lich_decode_cached(void)
+{
+    lich_cache_t cache;
+    viterbi_t ctx;
+    lsf_t lsf;
+    float symbs[SYM_PER_FRA];
+    uint8_t pld[16], pld_out[16], pld_ref[16];
+    uint8_t lich_out[5], lich_ref[5], cnt_out, cnt_ref;
+    uint16_t fn_out, fn_ref;
+
+    lich_cache_init(&cache);
+    viterbi_init(&ctx);
+    for(uint8_t i=0; i<sizeof(lsf_t); i++)
+        ((uint8_t*)&lsf)[i]=rand()%256;
+
+    //two superframes - the second one is served from the cache
+    for(uint16_t fn=0; fn<12; fn++)
+    {
+        for(uint8_t i=0; i<sizeof(pld); i++)
+            pld[i]=rand()%256;
+
+        gen_frame(symbs, pld, FRAME_STR, &lsf, fn%6, fn);
+        decode_str_frame_cached(&ctx, &cache, pld_out, lich_out, &fn_out, &cnt_out, &symbs[8]);
+        decode_str_frame(pld_ref, lich_ref, &fn_ref, &cnt_ref, &symbs[8]);
+
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(pld_ref, pld_out, sizeof(pld));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(lich_ref, lich_out, sizeof(lich_out));
+        TEST_ASSERT_EQUAL_UINT8(cnt_ref, cnt_out);
+        TEST_ASSERT_EQUAL_UINT16(fn_ref, fn_out);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(6, cache.hits);
+    TEST_ASSERT_EQUAL_UINT32(6, cache.misses);
+
+    //a marginal bit always takes the full decoder
+    uint8_t lich[6], lich_enc[12], out[6], ref[6];
+    uint16_t soft[96];
+
+    extract_LICH(lich, 0, &lsf);
+    encode_LICH(lich_enc, lich);
+    for(uint8_t i=0; i<96; i++)
+        soft[i]=((lich_enc[i/8]>>(7-i%8))&1)*0xFFFF;
+    soft[10]=0x7FFF;
+    decode_LICH_cached(&cache, out, soft);
+    decode_LICH(ref, soft);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(ref, out, 6);
+    TEST_ASSERT_EQUAL_UINT32(6, cache.hits);
+    TEST_ASSERT_EQUAL_UINT32(7, cache.misses);
+}
+
 //Viterbi
 void bits_to_soft(uint16_t *soft, const uint8_t *bits, size_t nbits)
 {
@@ -981,6 +1333,636 @@ void viterbi_stream_zero_cost(void)
     TEST_ASSERT(cost < 25); // punctured code is near-zero, but not quite zero :-)
 }
 
+void viterbi_ctx_interleaved(void)
+{
+    uint8_t payload[2][16];
+    uint8_t encoded_bits[2][272];
+    uint16_t soft_bits[2][272];
+    uint8_t ref[2][21] = {0}, dec[2][21] = {0};
+    uint32_t ref_cost[2], cost[2];
+    viterbi_t ctx[2];
+
+    for (int k = 0; k < 2; k++)
+    {
+        for (int i = 0; i < 16; i++)
+            payload[k][i] = rand();
+
+        conv_encode_stream_frame(encoded_bits[k], payload[k], rand());
+        bits_to_soft(soft_bits[k], encoded_bits[k], 272);
+        soft_bits[k][rand() % 272] ^= 0x7FFF;
+
+        ref_cost[k] = viterbi_decode_punctured(ref[k], soft_bits[k], puncture_pattern_2, 272, sizeof(puncture_pattern_2));
+        viterbi_init(&ctx[k]);
+    }
+
+    // step both trellises alternately, using unpunctured input
+    uint16_t umsg[2][296];
+    for (int k = 0; k < 2; k++)
+    {
+        for (int u = 0, i = 0; u < 296; u++)
+            umsg[k][u] = puncture_pattern_2[u % 12] ? soft_bits[k][i++] : 0x7FFF;
+        viterbi_reset_ctx(&ctx[k]);
+    }
+
+    for (int pos = 0; pos < 148; pos++)
+        for (int k = 0; k < 2; k++)
+            viterbi_decode_bit_ctx(&ctx[k], umsg[k][2*pos], umsg[k][2*pos+1], pos);
+
+    for (int k = 0; k < 2; k++)
+    {
+        cost[k] = viterbi_chainback_ctx(&ctx[k], dec[k], 148, 148) - 24*0x7FFF;
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(ref[k], dec[k], sizeof(dec[k]));
+        TEST_ASSERT_EQUAL_UINT32(ref_cost[k], cost[k]);
+    }
+}
+
+void viterbi_kernels_bit_exact(void)
+{
+    const viterbi_kernel_t kernels[] = {VITERBI_KERNEL_SSE2, VITERBI_KERNEL_AVX2, VITERBI_KERNEL_NEON};
+    uint16_t soft_bits[M17_VITERBI_HIST_LEN_2];
+    uint8_t ref[M17_VITERBI_HIST_LEN/8+2] = {0}, dec[M17_VITERBI_HIST_LEN/8+2] = {0};
+    viterbi_t ref_ctx, ctx;
+
+    viterbi_init(&ref_ctx);
+    viterbi_init(&ctx);
+    TEST_ASSERT_EQUAL_INT8(0, viterbi_set_kernel(&ref_ctx, VITERBI_KERNEL_SCALAR));
+
+    for (int j = 0; j < 20; j++)
+    {
+        // pure noise exercises ties and both branches of every butterfly
+        for (int i = 0; i < M17_VITERBI_HIST_LEN_2; i++)
+            soft_bits[i] = (j % 2) ? rand() % 0x10000 : (rand() % 3) * 0x7FFF;
+
+        uint32_t ref_cost = viterbi_decode_ctx(&ref_ctx, ref, soft_bits, M17_VITERBI_HIST_LEN_2);
+
+        for (size_t k = 0; k < sizeof(kernels)/sizeof(kernels[0]); k++)
+        {
+            if (viterbi_set_kernel(&ctx, kernels[k]) != 0)
+                continue; // not available on this CPU
+
+            uint32_t cost = viterbi_decode_ctx(&ctx, dec, soft_bits, M17_VITERBI_HIST_LEN_2);
+
+            TEST_ASSERT_EQUAL_UINT32(ref_cost, cost);
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(ref, dec, sizeof(ref));
+            TEST_ASSERT_EQUAL_UINT16_ARRAY(ref_ctx.history, ctx.history, M17_VITERBI_HIST_LEN);
+            TEST_ASSERT_EQUAL_UINT32_ARRAY(ref_ctx.prevMetrics, ctx.prevMetrics, M17_CONVOL_STATES);
+        }
+    }
+}
+
+void viterbi_punctured_inline(void)
+{
+    const uint8_t* patterns[] = {puncture_pattern_1, puncture_pattern_2, puncture_pattern_3};
+    const uint16_t p_lens[] = {sizeof(puncture_pattern_1), sizeof(puncture_pattern_2), sizeof(puncture_pattern_3)};
+    const uint16_t in_lens[] = {2*SYM_PER_PLD, 2*SYM_PER_PLD-96, 2*SYM_PER_PLD};
+    uint16_t in[2*SYM_PER_PLD], umsg[M17_VITERBI_HIST_LEN_2];
+    uint8_t ref[M17_VITERBI_HIST_LEN/8+2], dec[M17_VITERBI_HIST_LEN/8+2];
+    viterbi_t ctx;
+
+    viterbi_init(&ctx);
+
+    for (int j = 0; j < 30; j++)
+    {
+        uint8_t k = j % 3;
+
+        for (int i = 0; i < in_lens[k]; i++)
+            in[i] = rand() % 0x10000;
+
+        // reference: materialize the depunctured message first
+        uint16_t u = 0;
+        for (uint16_t i = 0, p = 0; i < in_lens[k]; p = (p + 1) % p_lens[k])
+            umsg[u++] = patterns[k][p] ? in[i++] : 0x7FFF;
+
+        memset(ref, 0, sizeof(ref));
+        memset(dec, 0, sizeof(dec));
+        uint32_t ref_cost = viterbi_decode_ctx(&ctx, ref, umsg, u) - (u - in_lens[k]) * 0x7FFF;
+        uint32_t cost = viterbi_decode_punctured_ctx(&ctx, dec, in, patterns[k], in_lens[k], p_lens[k]);
+
+        TEST_ASSERT_EQUAL_UINT32(ref_cost, cost);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(ref, dec, sizeof(ref));
+    }
+
+    // a pattern that depunctures past the decoder history is rejected
+    const uint8_t sparse[] = {1, 0, 0, 0};
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, viterbi_decode_punctured_ctx(&ctx, dec, in, sparse, 2*SYM_PER_PLD, sizeof(sparse)));
+}
+
+void viterbi_batch_bit_exact(void)
+{
+    const viterbi_kernel_t kernels[] = {VITERBI_KERNEL_SCALAR, VITERBI_KERNEL_SSE2, VITERBI_KERNEL_AVX2, VITERBI_KERNEL_NEON};
+    const uint8_t sizes[] = {1, 5, 8, 13, M17_VITERBI_BATCH_MAX};
+    static viterbi_batch_t ctx;
+    static float symbs[M17_VITERBI_BATCH_MAX][SYM_PER_FRA];
+    const float* pld[M17_VITERBI_BATCH_MAX];
+    uint8_t pld_in[16], lich_in[5];
+    lsf_t lsf_in;
+
+    for(uint8_t i=0; i<sizeof(lsf_t); i++)
+        ((uint8_t*)&lsf_in)[i]=rand()%256;
+
+    // noisy stream frames, so that the metrics differ from lane to lane
+    for (int l = 0; l < M17_VITERBI_BATCH_MAX; l++)
+    {
+        for (uint8_t i = 0; i < sizeof(pld_in); i++)
+            pld_in[i] = rand() % 256;
+
+        gen_frame(symbs[l], pld_in, FRAME_STR, &lsf_in, l % 6, l);
+        for (int i = 8; i < SYM_PER_FRA; i++)
+            symbs[l][i] += ((float)rand() / RAND_MAX - 0.5f) * 0.05f * l;
+
+        pld[l] = &symbs[l][8];
+    }
+
+    viterbi_batch_init(&ctx);
+
+    for (size_t k = 0; k < sizeof(kernels)/sizeof(kernels[0]); k++)
+    {
+        if (viterbi_batch_set_kernel(&ctx, kernels[k]) != 0)
+            continue; // not available on this CPU
+
+        for (size_t j = 0; j < sizeof(sizes); j++)
+        {
+            uint8_t n = sizes[j];
+            uint8_t data[M17_VITERBI_BATCH_MAX][16], lich[M17_VITERBI_BATCH_MAX][5];
+            uint16_t fn[M17_VITERBI_BATCH_MAX];
+            uint8_t lich_cnt[M17_VITERBI_BATCH_MAX];
+            uint32_t e[M17_VITERBI_BATCH_MAX];
+
+            TEST_ASSERT_EQUAL_INT8(0, decode_str_frame_batch(&ctx, data, lich, fn, lich_cnt, e, pld, n));
+
+            for (uint8_t l = 0; l < n; l++)
+            {
+                uint8_t ref_data[16];
+                uint16_t ref_fn;
+                uint8_t ref_lich_cnt;
+
+                uint32_t ref_e = decode_str_frame(ref_data, lich_in, &ref_fn, &ref_lich_cnt, pld[l]);
+
+                TEST_ASSERT_EQUAL_UINT32(ref_e, e[l]);
+                TEST_ASSERT_EQUAL_UINT8_ARRAY(ref_data, data[l], 16);
+                TEST_ASSERT_EQUAL_UINT8_ARRAY(lich_in, lich[l], 5);
+                TEST_ASSERT_EQUAL_UINT16(ref_fn, fn[l]);
+                TEST_ASSERT_EQUAL_UINT8(ref_lich_cnt, lich_cnt[l]);
+            }
+        }
+    }
+
+    TEST_ASSERT_EQUAL_INT8(-1, decode_str_frame_batch(&ctx, NULL, NULL, NULL, NULL, NULL, pld, 0));
+    TEST_ASSERT_EQUAL_INT8(-1, decode_str_frame_batch(&ctx, NULL, NULL, NULL, NULL, NULL, pld, M17_VITERBI_BATCH_MAX+1));
+}
+
+void viterbi_stream_long(void)
+{
+    // far beyond the 244-step history of the block decoder
+    enum { N = 3000 };
+    static uint8_t ud[4+N+4], dec[N+4+2*M17_VITERBI_STREAM_DEPTH_MAX];
+    static uint16_t soft[2*(N+4)];
+    static viterbi_stream_t ctx;
+    const uint8_t no_kept[2] = {0, 0};
+    uint32_t cost;
+
+    memset(ud, 0, sizeof(ud));
+    for (int i = 0; i < N; i++)
+        ud[4+i] = rand() % 2;
+
+    for (int i = 0; i < N+4; i++)
+    {
+        uint8_t G1 = (ud[i+4]                + ud[i+1] + ud[i+0]) & 1;
+        uint8_t G2 = (ud[i+4] + ud[i+3] + ud[i+2]           + ud[i+0]) & 1;
+
+        // strong noise, a hard error every 50 bits
+        soft[2*i+0] = G1 ? 0xFFFF - rand() % 0x4000 : rand() % 0x4000;
+        soft[2*i+1] = G2 ? 0xFFFF - rand() % 0x4000 : rand() % 0x4000;
+        if (i % 25 == 0)
+            soft[2*i] ^= 0xFFFF;
+    }
+
+    TEST_ASSERT_EQUAL_INT8(-1, viterbi_stream_init(&ctx, 0, NULL, 0));
+    TEST_ASSERT_EQUAL_INT8(-1, viterbi_stream_init(&ctx, M17_VITERBI_STREAM_DEPTH_MAX+1, NULL, 0));
+    TEST_ASSERT_EQUAL_INT8(-1, viterbi_stream_init(&ctx, 40, puncture_pattern_2, 0));
+    TEST_ASSERT_EQUAL_INT8(-1, viterbi_stream_init(&ctx, 40, no_kept, sizeof(no_kept))); // would never consume input
+    TEST_ASSERT_EQUAL_INT8(0, viterbi_stream_init(&ctx, 40, NULL, 0));
+
+    // twice, to make sure flushing leaves the decoder ready for the next stream
+    for (int j = 0; j < 2; j++)
+    {
+        uint16_t n = 0;
+        for (int i = 0; i < 2*(N+4); )
+        {
+            uint16_t len = rand() % 50; // odd chunks, empty chunks
+            if (i + len > 2*(N+4))
+                len = 2*(N+4) - i;
+
+            n += viterbi_stream_push(&ctx, &dec[n], &soft[i], len);
+            i += len;
+        }
+        n += viterbi_stream_flush(&ctx, &dec[n], &cost);
+
+        TEST_ASSERT_EQUAL_UINT16(N+4, n);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(&ud[4], dec, N+4);
+        TEST_ASSERT_TRUE(cost > 0);
+    }
+}
+
+void viterbi_stream_punctured(void)
+{
+    uint8_t fn[2], data[16], enc[2*SYM_PER_PLD-96], dec[2*M17_VITERBI_STREAM_DEPTH_MAX];
+    uint16_t soft[2*SYM_PER_PLD-96];
+    viterbi_stream_t ctx;
+    uint32_t cost;
+    uint16_t fn_in = rand() % 0x10000;
+
+    for (uint8_t i = 0; i < sizeof(data); i++)
+        data[i] = rand() % 256;
+    fn[0] = fn_in >> 8;
+    fn[1] = fn_in & 0xFF;
+
+    conv_encode_stream_frame(enc, data, fn_in);
+    for (uint16_t i = 0; i < sizeof(enc); i++)
+        soft[i] = enc[i] ? 0xFFFF : 0;
+
+    // the whole frame fits in the window, so the result is exactly the block decoder's
+    TEST_ASSERT_EQUAL_INT8(0, viterbi_stream_init(&ctx, M17_VITERBI_STREAM_DEPTH_MAX, puncture_pattern_2, sizeof(puncture_pattern_2)));
+
+    uint16_t n = viterbi_stream_push(&ctx, dec, soft, sizeof(soft)/sizeof(soft[0]));
+    n += viterbi_stream_flush(&ctx, &dec[n], &cost);
+
+    TEST_ASSERT_EQUAL_UINT16(16+128+4, n);
+    uint8_t ref[(16+128)/8+1]; //1 byte extra for flushing
+    TEST_ASSERT_EQUAL_UINT32(viterbi_decode_punctured_ctx(&ctx.vit, ref, soft, puncture_pattern_2, sizeof(soft)/sizeof(soft[0]), sizeof(puncture_pattern_2)), cost);
+    for (int i = 0; i < 16; i++)
+        TEST_ASSERT_EQUAL_UINT8((fn[i/8] >> (7-i%8)) & 1, dec[i]);
+    for (int i = 0; i < 128; i++)
+        TEST_ASSERT_EQUAL_UINT8((data[i/8] >> (7-i%8)) & 1, dec[16+i]);
+}
+
+void viterbi_hard_decision(void)
+{
+    const viterbi_kernel_t kernels[] = {VITERBI_KERNEL_SSE2, VITERBI_KERNEL_AVX2, VITERBI_KERNEL_NEON};
+    uint8_t data[16], enc[2*SYM_PER_PLD-96];
+    uint8_t ref[(16+128)/8+1] = {0}, dec[(16+128)/8+1] = {0}; //1 byte extra for flushing
+    uint16_t soft[2*SYM_PER_PLD-96];
+    uint16_t fn_in = rand() % 0x10000;
+    viterbi_t ref_ctx, ctx;
+
+    for (uint8_t i = 0; i < sizeof(data); i++)
+        data[i] = rand() % 256;
+    conv_encode_stream_frame(enc, data, fn_in);
+
+    viterbi_init(&ref_ctx);
+    viterbi_init(&ctx);
+    TEST_ASSERT_EQUAL_INT8(0, viterbi_set_kernel(&ref_ctx, VITERBI_KERNEL_SCALAR));
+
+    for (int j = 0; j < 20; j++)
+    {
+        // soft noise on every bit, plus j hard errors
+        for (uint16_t i = 0; i < sizeof(enc); i++)
+            soft[i] = enc[i] ? 0xFFFF - rand() % 0x7000 : rand() % 0x7000;
+        for (int i = 0; i < j; i++)
+            soft[rand() % sizeof(enc)] ^= 0xFFFF;
+
+        uint32_t ref_err = viterbi_decode_punctured_hard_ctx(&ref_ctx, ref, soft, puncture_pattern_2, sizeof(enc), sizeof(puncture_pattern_2));
+
+        if (j == 0)
+        {
+            TEST_ASSERT_EQUAL_UINT32(0, ref_err);
+            TEST_ASSERT_EQUAL_UINT16(fn_in, (ref[1] << 8) | ref[2]);
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(data, &ref[3], 16);
+        }
+
+        for (size_t k = 0; k < sizeof(kernels)/sizeof(kernels[0]); k++)
+        {
+            if (viterbi_set_kernel(&ctx, kernels[k]) != 0)
+                continue; // not available on this CPU
+
+            uint32_t err = viterbi_decode_punctured_hard_ctx(&ctx, dec, soft, puncture_pattern_2, sizeof(enc), sizeof(puncture_pattern_2));
+
+            TEST_ASSERT_EQUAL_UINT32(ref_err, err);
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(ref, dec, sizeof(ref));
+        }
+    }
+}
+
+void viterbi_hard_fallback(void)
+{
+    uint8_t pld_in[16], pld_out[16], lich[5];
+    lsf_t lsf_in;
+    float symbs[SYM_PER_FRA];
+    viterbi_t soft_ctx, hard_ctx;
+
+    for (uint8_t i = 0; i < sizeof(pld_in); i++)
+        pld_in[i] = rand() % 256;
+    for (uint8_t i = 0; i < sizeof(lsf_t); i++)
+        ((uint8_t*)&lsf_in)[i] = rand() % 256;
+
+    viterbi_init(&soft_ctx);
+    viterbi_init(&hard_ctx);
+    TEST_ASSERT_EQUAL_INT8(-1, viterbi_set_opts(&hard_ctx, 0x80, 0));
+    TEST_ASSERT_EQUAL_INT8(0, viterbi_set_opts(&hard_ctx, M17_VITERBI_OPT_HARD, 2));
+
+    // clean frame - the hard decision decoder is enough
+    gen_frame(symbs, pld_in, FRAME_STR, &lsf_in, 0, 0);
+    TEST_ASSERT_EQUAL_UINT32(0, decode_str_frame_ctx(&hard_ctx, pld_out, lich, NULL, NULL, &symbs[8]));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(pld_in, pld_out, 16);
+
+    // every 10th symbol is flipped - falls back to soft decoding, with the same result
+    for (int i = 8; i < SYM_PER_FRA; i += 10)
+        symbs[i] = -symbs[i];
+
+    uint8_t soft_out[16];
+    uint32_t e_soft = decode_str_frame_ctx(&soft_ctx, soft_out, lich, NULL, NULL, &symbs[8]);
+    uint32_t e_hard = decode_str_frame_ctx(&hard_ctx, pld_out, lich, NULL, NULL, &symbs[8]);
+
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(soft_out, pld_out, 16);
+    TEST_ASSERT_EQUAL_UINT32(e_soft, e_hard);
+}
+
+void viterbi_shortcut(void)
+{
+    uint8_t pld_in[26], pld_out[25], ref_out[25], lich[5];
+    lsf_t lsf_in, lsf_out, lsf_ref;
+    float symbs[SYM_PER_FRA];
+    viterbi_t soft_ctx, ctx;
+
+    for (uint8_t i = 0; i < sizeof(pld_in); i++)
+        pld_in[i] = rand() % 256;
+    for (uint8_t i = 0; i < sizeof(lsf_t); i++)
+        ((uint8_t*)&lsf_in)[i] = rand() % 256;
+
+    viterbi_init(&soft_ctx);
+    viterbi_init(&ctx);
+    TEST_ASSERT_EQUAL_INT8(0, viterbi_set_opts(&ctx, M17_VITERBI_OPT_SHORTCUT, 0));
+
+    for (int j = 0; j < 3; j++)
+    {
+        // mild noise does not change any hard decision - the shortcut is taken with the exact soft metric
+        gen_frame(symbs, NULL, FRAME_LSF, &lsf_in, 0, 0);
+        for (int i = 8; i < SYM_PER_FRA; i++)
+            symbs[i] += ((float)rand() / RAND_MAX - 0.5f) * 0.4f * j;
+        TEST_ASSERT_EQUAL_UINT32(decode_LSF_ctx(&soft_ctx, &lsf_ref, &symbs[8]), decode_LSF_ctx(&ctx, &lsf_out, &symbs[8]));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(&lsf_ref, &lsf_out, sizeof(lsf_t));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(&lsf_in, &lsf_out, sizeof(lsf_t));
+        TEST_ASSERT_EQUAL(VITERBI_PATH_SHORTCUT, ctx.last_path);
+
+        gen_frame(symbs, pld_in, FRAME_STR, &lsf_in, 0, 0);
+        for (int i = 8; i < SYM_PER_FRA; i++)
+            symbs[i] += ((float)rand() / RAND_MAX - 0.5f) * 0.4f * j;
+        TEST_ASSERT_EQUAL_UINT32(decode_str_frame_ctx(&soft_ctx, ref_out, lich, NULL, NULL, &symbs[8]), decode_str_frame_ctx(&ctx, pld_out, lich, NULL, NULL, &symbs[8]));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(ref_out, pld_out, 16);
+        TEST_ASSERT_EQUAL(VITERBI_PATH_SHORTCUT, ctx.last_path);
+
+        gen_frame(symbs, pld_in, FRAME_PKT, NULL, 0, 0);
+        for (int i = 8; i < SYM_PER_FRA; i++)
+            symbs[i] += ((float)rand() / RAND_MAX - 0.5f) * 0.4f * j;
+        TEST_ASSERT_EQUAL_UINT32(decode_pkt_frame_ctx(&soft_ctx, ref_out, NULL, NULL, &symbs[8]), decode_pkt_frame_ctx(&ctx, pld_out, NULL, NULL, &symbs[8]));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(ref_out, pld_out, 25);
+        TEST_ASSERT_EQUAL(VITERBI_PATH_SHORTCUT, ctx.last_path);
+    }
+
+    // a symbol with a wrong hard decision needs the full trellis
+    gen_frame(symbs, pld_in, FRAME_PKT, NULL, 0, 0);
+    symbs[50] = -symbs[50];
+    TEST_ASSERT_EQUAL_UINT32(decode_pkt_frame_ctx(&soft_ctx, ref_out, NULL, NULL, &symbs[8]), decode_pkt_frame_ctx(&ctx, pld_out, NULL, NULL, &symbs[8]));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(ref_out, pld_out, 25);
+    TEST_ASSERT_EQUAL(VITERBI_PATH_SOFT, ctx.last_path);
+
+    TEST_ASSERT_EQUAL_UINT32(9, ctx.path_cnt[VITERBI_PATH_SHORTCUT]);
+    TEST_ASSERT_EQUAL_UINT32(1, ctx.path_cnt[VITERBI_PATH_SOFT]);
+    TEST_ASSERT_EQUAL_UINT32(0, ctx.path_cnt[VITERBI_PATH_HARD]);
+}
+
+void viterbi_sova_lsf(void)
+{
+    static viterbi_sova_t sova_ctx;
+    viterbi_t ctx;
+    lsf_t lsf_in, lsf_out, lsf_ref;
+    float symbs[SYM_PER_FRA];
+    uint16_t rel[240];
+    uint64_t rel_right = 0, rel_wrong = 0, n_right = 0, n_wrong = 0;
+
+    viterbi_sova_init(&sova_ctx);
+    viterbi_init(&ctx);
+
+    // enough frames for a stable average
+    for (int j = 0; j < 200; j++)
+    {
+        for (uint8_t i = 0; i < sizeof(lsf_t); i++)
+            ((uint8_t*)&lsf_in)[i] = rand() % 256;
+
+        gen_frame(symbs, NULL, FRAME_LSF, &lsf_in, 0, 0);
+        for (int i = 8; i < SYM_PER_FRA; i++)
+            symbs[i] += ((float)rand() / RAND_MAX - 0.5f) * 3.0f;
+
+        // same bits and metric as the plain soft decoder
+        uint32_t e = decode_LSF_sova(&sova_ctx, &lsf_out, rel, &symbs[8]);
+        TEST_ASSERT_EQUAL_UINT32(decode_LSF_ctx(&ctx, &lsf_ref, &symbs[8]), e);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(&lsf_ref, &lsf_out, sizeof(lsf_t));
+
+        for (int b = 0; b < 240; b++)
+        {
+            if (((((uint8_t*)&lsf_in)[b/8] ^ ((uint8_t*)&lsf_out)[b/8]) >> (7-b%8)) & 1)
+            {
+                rel_wrong += rel[b];
+                n_wrong++;
+            }
+            else
+            {
+                rel_right += rel[b];
+                n_right++;
+            }
+        }
+    }
+
+    // decoding errors have to be far less reliable on average
+    // (0.40..0.53 of the correct bits' reliability over 1000 seeds)
+    TEST_ASSERT_TRUE(n_wrong > 0);
+    TEST_ASSERT_TRUE(rel_wrong / n_wrong * 3 < rel_right / n_right * 2);
+}
+
+void viterbi_llr_frames(void)
+{
+    const viterbi_kernel_t kernels[] = {VITERBI_KERNEL_SSE2, VITERBI_KERNEL_AVX2, VITERBI_KERNEL_NEON};
+    uint8_t pld_in[26], pld_out[25], lich_in[5], lich_out[5], lich_cnt_out, eof_out, pfn_out;
+    uint16_t fn_out;
+    lsf_t lsf_in, lsf_out;
+    float symbs[SYM_PER_FRA];
+    viterbi_t ctx;
+
+    for (uint8_t i = 0; i < sizeof(pld_in); i++)
+        pld_in[i] = rand() % 256;
+    for (uint8_t i = 0; i < sizeof(lsf_t); i++)
+        ((uint8_t*)&lsf_in)[i] = rand() % 256;
+    for (uint8_t i = 0; i < 5; i++)
+        lich_in[i] = ((uint8_t*)&lsf_in)[3*5+i];
+
+    viterbi_init(&ctx);
+
+    for (int j = 0; j < 2; j++)
+    {
+        // j=1: noise, plus every 20th symbol flipped
+        gen_frame(symbs, NULL, FRAME_LSF, &lsf_in, 0, 0);
+        for (int i = 8; i < SYM_PER_FRA && j; i++)
+            symbs[i] = (i % 20 ? symbs[i] : -symbs[i]) + ((float)rand() / RAND_MAX - 0.5f);
+        uint32_t e = decode_LSF_llr(&ctx, &lsf_out, &symbs[8]);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(&lsf_in, &lsf_out, sizeof(lsf_t));
+        if (j == 0)
+            TEST_ASSERT_EQUAL_UINT32(0, e);
+
+        gen_frame(symbs, pld_in, FRAME_STR, &lsf_in, 3, 0x1234);
+        for (int i = 8; i < SYM_PER_FRA && j; i++)
+            symbs[i] = (i % 20 ? symbs[i] : -symbs[i]) + ((float)rand() / RAND_MAX - 0.5f);
+        e = decode_str_frame_llr(&ctx, pld_out, lich_out, &fn_out, &lich_cnt_out, &symbs[8]);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(pld_in, pld_out, 16);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(lich_in, lich_out, 5);
+        TEST_ASSERT_EQUAL_UINT16(0x1234, fn_out);
+        TEST_ASSERT_EQUAL_UINT8(3, lich_cnt_out);
+        if (j == 0)
+            TEST_ASSERT_EQUAL_UINT32(0, e);
+
+        gen_frame(symbs, pld_in, FRAME_PKT, NULL, 0, 0);
+        for (int i = 8; i < SYM_PER_FRA && j; i++)
+            symbs[i] = (i % 20 ? symbs[i] : -symbs[i]) + ((float)rand() / RAND_MAX - 0.5f);
+        e = decode_pkt_frame_llr(&ctx, pld_out, &eof_out, &pfn_out, &symbs[8]);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(pld_in, pld_out, 25);
+        if (j == 0)
+            TEST_ASSERT_EQUAL_UINT32(0, e);
+    }
+
+    // all kernels are bit-exact with the scalar one, also on pure noise
+    int8_t llr[2*SYM_PER_PLD];
+    uint8_t ref[31], dec[31];
+    viterbi_t ref_ctx;
+
+    viterbi_init(&ref_ctx);
+    TEST_ASSERT_EQUAL_INT8(0, viterbi_set_kernel(&ref_ctx, VITERBI_KERNEL_SCALAR));
+
+    for (int j = 0; j < 10; j++)
+    {
+        for (uint16_t i = 0; i < sizeof(llr); i++)
+            llr[i] = rand() % 256 - 128;
+
+        uint32_t ref_e = viterbi_decode_punctured_llr(&ref_ctx, ref, llr, puncture_pattern_1, sizeof(llr), sizeof(puncture_pattern_1));
+
+        for (size_t k = 0; k < sizeof(kernels)/sizeof(kernels[0]); k++)
+        {
+            if (viterbi_set_kernel(&ctx, kernels[k]) != 0)
+                continue; // not available on this CPU
+
+            TEST_ASSERT_EQUAL_UINT32(ref_e, viterbi_decode_punctured_llr(&ctx, dec, llr, puncture_pattern_1, sizeof(llr), sizeof(puncture_pattern_1)));
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(ref, dec, sizeof(ref));
+        }
+    }
+}
+
+void conv_encode_packed_frames(void)
+{
+    uint8_t in[30], unpacked[SYM_PER_PLD*2], packed[SYM_PER_PLD*2/8];
+    lsf_t lsf;
+
+    for (int j = 0; j < 10; j++)
+    {
+        for (uint8_t i = 0; i < sizeof(in); i++)
+            in[i] = rand() % 256;
+        memcpy(&lsf, in, sizeof(lsf));
+        uint16_t fn = rand() % 0x10000;
+
+        conv_encode_stream_frame(unpacked, in, fn);
+        conv_encode_stream_frame_packed(packed, in, fn);
+        for (int i = 0; i < 272; i++)
+            TEST_ASSERT_EQUAL_UINT8(unpacked[i], (packed[i/8] >> (7-i%8)) & 1);
+
+        conv_encode_packet_frame(unpacked, in);
+        conv_encode_packet_frame_packed(packed, in);
+        for (int i = 0; i < SYM_PER_PLD*2; i++)
+            TEST_ASSERT_EQUAL_UINT8(unpacked[i], (packed[i/8] >> (7-i%8)) & 1);
+
+        conv_encode_LSF(unpacked, &lsf);
+        conv_encode_LSF_packed(packed, &lsf);
+        for (int i = 0; i < SYM_PER_PLD*2; i++)
+            TEST_ASSERT_EQUAL_UINT8(unpacked[i], (packed[i/8] >> (7-i%8)) & 1);
+
+        conv_encode_bert_frame(unpacked, in);
+        conv_encode_bert_frame_packed(packed, in);
+        for (int i = 0; i < SYM_PER_PLD*2; i++)
+            TEST_ASSERT_EQUAL_UINT8(unpacked[i], (packed[i/8] >> (7-i%8)) & 1);
+    }
+
+    // an empty puncturing matrix writes nothing
+    uint16_t enc[4] = {0};
+    TEST_ASSERT_EQUAL_UINT16(0, conv_puncture_packed(packed, enc, 64, puncture_pattern_2, 0, 64));
+}
+
+void gen_frame_fused(void)
+{
+    uint8_t in[30], lich[6], lich_enc[12];
+    uint8_t enc_bits[SYM_PER_PLD*2], rf_bits[SYM_PER_PLD*2], packed[SYM_PER_PLD*2/8];
+    int8_t symbs[SYM_PER_FRA];
+    lsf_t lsf;
+
+    for (int j = 0; j < 10; j++)
+    {
+        for (uint8_t i = 0; i < sizeof(in); i++)
+            in[i] = rand() % 256;
+        memcpy(&lsf, in, sizeof(lsf));
+        uint16_t fn = rand() % 0x10000;
+        uint8_t lich_cnt = rand() % 6;
+
+        for (frame_t type = FRAME_LSF; type <= FRAME_BERT; type++)
+        {
+            //reference: separate encode, reorder and randomize passes
+            if (type == FRAME_LSF)
+                conv_encode_LSF(enc_bits, &lsf);
+            else if (type == FRAME_STR)
+            {
+                extract_LICH(lich, lich_cnt, &lsf);
+                encode_LICH(lich_enc, lich);
+                unpack_LICH(enc_bits, lich_enc);
+                conv_encode_stream_frame(&enc_bits[96], in, fn);
+            }
+            else if (type == FRAME_PKT)
+                conv_encode_packet_frame(enc_bits, in);
+            else
+                conv_encode_bert_frame(enc_bits, in);
+            reorder_bits(rf_bits, enc_bits);
+            randomize_bits(rf_bits);
+
+            gen_frame_bits(packed, in, type, &lsf, lich_cnt, fn);
+            for (int i = 0; i < SYM_PER_PLD*2; i++)
+                TEST_ASSERT_EQUAL_UINT8(rf_bits[i], (packed[i/8] >> (7-i%8)) & 1);
+
+            gen_frame_i8(symbs, in, type, &lsf, lich_cnt, fn);
+            for (int i = 0; i < SYM_PER_PLD; i++)
+                TEST_ASSERT_EQUAL_INT8(symbol_map[rf_bits[2*i]*2+rf_bits[2*i+1]], symbs[SYM_PER_SWD+i]);
+        }
+    }
+}
+
+void reorder_randomize_packed(void)
+{
+    uint8_t bits[SYM_PER_PLD*2], ref[SYM_PER_PLD*2];
+    uint8_t packed[SYM_PER_PLD*2/8], out[SYM_PER_PLD*2/8];
+
+    for (int j = 0; j < 10; j++)
+    {
+        memset(packed, 0, sizeof(packed));
+        for (int i = 0; i < SYM_PER_PLD*2; i++)
+        {
+            bits[i] = rand() % 2;
+            packed[i/8] |= bits[i] << (7-i%8);
+        }
+
+        reorder_bits(ref, bits);
+        reorder_packed(out, packed);
+        for (int i = 0; i < SYM_PER_PLD*2; i++)
+            TEST_ASSERT_EQUAL_UINT8(ref[i], (out[i/8] >> (7-i%8)) & 1);
+
+        randomize_bits(ref);
+        randomize_packed(out);
+        for (int i = 0; i < SYM_PER_PLD*2; i++)
+            TEST_ASSERT_EQUAL_UINT8(ref[i], (out[i/8] >> (7-i%8)) & 1);
+    }
+}
+
 void lsf_encode_decode(void)
 {
     lsf_t lsf_in, lsf_out;
@@ -1161,6 +2143,360 @@ void crc_checks(void)
     testvec[101] ^= 0xFF;
 }
 
+void crc_chase(void)
+{
+    lsf_t lsf, lsf_ok;
+    uint16_t rel[240];
+
+    for (uint8_t i = 0; i < sizeof(lsf_t); i++)
+        ((uint8_t*)&lsf_ok)[i] = rand() % 256;
+    update_LSF_CRC(&lsf_ok);
+
+    for (int b = 0; b < 240; b++)
+        rel[b] = 0x8000 + rand() % 0x8000;
+
+    // already valid
+    lsf = lsf_ok;
+    TEST_ASSERT_EQUAL_INT32(0, CRC_M17_chase((uint8_t*)&lsf, sizeof(lsf_t), rel, 10));
+
+    // 3 corrupted bits, among the 4 least reliable ones
+    const uint16_t bad[3] = {17, 130, 238};
+    rel[200] = 0x0300;
+    for (int k = 0; k < 3; k++)
+    {
+        rel[bad[k]] = 0x0100 * (k + 1);
+        ((uint8_t*)&lsf)[bad[k]/8] ^= 0x80 >> (bad[k]%8);
+    }
+
+    // not enough budget - data stays as it was
+    lsf_t lsf_bad = lsf;
+    TEST_ASSERT_EQUAL_INT32(-1, CRC_M17_chase((uint8_t*)&lsf, sizeof(lsf_t), rel, 0));
+    TEST_ASSERT_EQUAL_INT32(-1, CRC_M17_chase((uint8_t*)&lsf, sizeof(lsf_t), rel, 3));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(&lsf_bad, &lsf, sizeof(lsf_t));
+
+    int32_t tries = CRC_M17_chase((uint8_t*)&lsf, sizeof(lsf_t), rel, 15);
+    TEST_ASSERT_TRUE(tries > 0 && tries <= 15);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(&lsf_ok, &lsf, sizeof(lsf_t));
+}
+
+void rrc_interpolator(void)
+{
+    const uint8_t sps_list[] = {10, 5};
+    const float* taps_list[] = {rrc_taps_10, rrc_taps_5};
+    int8_t symbs[3*SYM_PER_FRA];
+    float out[3*SYM_PER_FRA*10];
+    rrc_interp_t ctx;
+
+    TEST_ASSERT_EQUAL_INT8(-1, rrc_interp_init(&ctx, 7));
+
+    for (uint16_t i = 0; i < sizeof(symbs); i++)
+        symbs[i] = symbol_list[rand() % 4];
+
+    for (uint8_t k = 0; k < 2; k++)
+    {
+        const uint8_t sps = sps_list[k];
+        uint32_t n = 0;
+
+        TEST_ASSERT_EQUAL_INT8(0, rrc_interp_init(&ctx, sps));
+
+        // three frames in separate calls, float and int8 input
+        n += rrc_interp_i8(&ctx, &out[n], &symbs[0], SYM_PER_FRA);
+        float tmp[SYM_PER_FRA];
+        for (uint16_t i = 0; i < SYM_PER_FRA; i++)
+            tmp[i] = symbs[SYM_PER_FRA+i];
+        n += rrc_interp(&ctx, &out[n], tmp, SYM_PER_FRA);
+        n += rrc_interp_i8(&ctx, &out[n], &symbs[2*SYM_PER_FRA], SYM_PER_FRA);
+        TEST_ASSERT_EQUAL_UINT32(3*SYM_PER_FRA*sps, n);
+
+        // reference: zero-stuffed upsampling and the full-length filter
+        for (uint32_t j = 0; j < n; j++)
+        {
+            float ref = 0;
+
+            for (uint16_t t = 0; t <= 8*sps; t++)
+                if (t <= j && (j-t) % sps == 0)
+                    ref += taps_list[k][t] * symbs[(j-t)/sps];
+
+            TEST_ASSERT_FLOAT_WITHIN(1e-5f, ref, out[j]);
+        }
+    }
+}
+
+void rrc_decimator(void)
+{
+    const uint8_t sps_list[] = {10, 5};
+    int8_t symbs[2*SYM_PER_FRA];
+    float bb[2*SYM_PER_FRA*10], ref[2*SYM_PER_FRA+1], out[2*SYM_PER_FRA+1];
+    rrc_interp_t tx;
+    rrc_decim_t rx;
+
+    TEST_ASSERT_EQUAL_INT8(-1, rrc_decim_init(&rx, 10, 10));
+    TEST_ASSERT_EQUAL_INT8(-1, rrc_decim_init(&rx, 8, 0));
+
+    for (uint16_t i = 0; i < sizeof(symbs); i++)
+        symbs[i] = symbol_list[rand() % 4];
+
+    for (uint8_t k = 0; k < 2; k++)
+    {
+        const uint8_t sps = sps_list[k];
+
+        TEST_ASSERT_EQUAL_INT8(0, rrc_interp_init(&tx, sps));
+        uint32_t n = rrc_interp_i8(&tx, bb, symbs, sizeof(symbs));
+
+        // TX and RX filters delay by 4 symbols each - matched filter output hits the symbols
+        TEST_ASSERT_EQUAL_INT8(0, rrc_decim_init(&rx, sps, 0));
+        TEST_ASSERT_EQUAL_UINT32(sizeof(symbs), rrc_decim(&rx, ref, bb, n));
+        for (uint16_t i = 8; i < sizeof(symbs); i++)
+            TEST_ASSERT_FLOAT_WITHIN(0.1f, symbs[i-8], ref[i]);
+
+        // any split of the input gives the same symbols
+        rrc_decim_reset(&rx);
+        uint32_t m = 0, pos = 0;
+        while (pos < n)
+        {
+            uint32_t len = rand() % 500 + 1;
+            if (len > n - pos)
+                len = n - pos;
+            m += rrc_decim(&rx, &out[m], &bb[pos], len);
+            pos += len;
+        }
+        TEST_ASSERT_EQUAL_UINT32(sizeof(symbs), m);
+        for (uint16_t i = 0; i < m; i++)
+            TEST_ASSERT_FLOAT_WITHIN(1e-5f, ref[i], out[i]);
+    }
+}
+
+void symbol_sync_recovery(void)
+{
+    const uint8_t sps_list[] = {10, 5};
+    int8_t symbs[2*SYM_PER_FRA];
+    float bb[2*SYM_PER_FRA*10], ref[2*SYM_PER_FRA*10/(5-1)+1], out[2*SYM_PER_FRA*10/(5-1)+1];
+    rrc_interp_t tx;
+    symbol_sync_t rx;
+
+    TEST_ASSERT_EQUAL_INT8(-1, symbol_sync_init(&rx, 8));
+
+    for (uint16_t i = 0; i < sizeof(symbs); i++)
+        symbs[i] = symbol_list[rand() % 4];
+
+    for (uint8_t k = 0; k < 2; k++)
+    {
+        const uint8_t sps = sps_list[k];
+
+        TEST_ASSERT_EQUAL_INT8(0, rrc_interp_init(&tx, sps));
+        uint32_t n = rrc_interp_i8(&tx, bb, symbs, sizeof(symbs));
+        for (uint32_t i = 0; i < n; i++)
+            bb[i] += ((float)rand() / RAND_MAX - 0.5f) * 0.2f;
+
+        for (uint8_t d = 0; d < sps; d++)
+        {
+            // input starts d samples late - the symbol centres move to phase sps-d
+            TEST_ASSERT_EQUAL_INT8(0, symbol_sync_init(&rx, sps));
+            uint32_t m = symbol_sync(&rx, ref, &bb[d], n - d);
+            TEST_ASSERT_UINT32_WITHIN(3, (n - d) / sps, m);
+            TEST_ASSERT_EQUAL_UINT8((sps - d) % sps, rx.phase);
+
+            // TX and RX filter delays, give or take the symbols slipped during acquisition
+            int8_t off = 0;
+            float e_min = 1e9f;
+            for (int8_t o = -12; o <= -4; o++)
+            {
+                float e = 0;
+                for (uint16_t i = 200; i < m - 1; i++)
+                    e += fabsf(symbs[i + o] - ref[i]);
+                if (e < e_min)
+                {
+                    e_min = e;
+                    off = o;
+                }
+            }
+            for (uint16_t i = 200; i < m - 1; i++)
+                TEST_ASSERT_FLOAT_WITHIN(0.3f, symbs[i + off], ref[i]);
+        }
+
+        // any split of the input gives the same symbols
+        symbol_sync_reset(&rx);
+        uint32_t m = 0, pos = 0;
+        while (pos < n)
+        {
+            uint32_t len = rand() % 500 + 1;
+            if (len > n - pos)
+                len = n - pos;
+            m += symbol_sync(&rx, &out[m], &bb[pos], len);
+            pos += len;
+        }
+        symbol_sync_init(&rx, sps);
+        TEST_ASSERT_EQUAL_UINT32(symbol_sync(&rx, ref, bb, n), m);
+        for (uint16_t i = 0; i < m; i++)
+            TEST_ASSERT_FLOAT_WITHIN(1e-5f, ref[i], out[i]);
+    }
+}
+
+typedef struct
+{
+    uint8_t n;
+    sync_hit_t hit[8];
+    lsf_t lsf;
+    uint8_t pld[8][25];
+} sync_log_t;
+
+static void sync_log_cb(const sync_hit_t* hit, const float pld_symbs[SYM_PER_PLD], void* user)
+{
+    sync_log_t* log = (sync_log_t*)user;
+    uint8_t lich[5], lich_cnt, eof, fn8;
+    uint16_t fn;
+
+    if (log->n >= 8)
+        return;
+
+    if (hit->type == SWD_LSF)
+        decode_LSF(&log->lsf, pld_symbs);
+    else if (hit->type == SWD_STR)
+        decode_str_frame(log->pld[log->n], lich, &fn, &lich_cnt, pld_symbs);
+    else if (hit->type == SWD_PKT)
+        decode_pkt_frame(log->pld[log->n], &eof, &fn8, pld_symbs);
+
+    log->hit[log->n++] = *hit;
+}
+
+void sync_detector(void)
+{
+    const uint32_t lead = 77; // noise before the transmission, not a multiple of 4
+    const syncword_t types[] = {SWD_LSF, SWD_STR, SWD_STR, SWD_PKT, SWD_BERT, SWD_EOT};
+    float symbs[77 + 7*SYM_PER_FRA + 50];
+    uint8_t pld_in[26];
+    lsf_t lsf_in;
+    sync_detect_t det;
+    sync_log_t log;
+    uint32_t cnt = 0;
+
+    for (uint8_t i = 0; i < sizeof(pld_in); i++)
+        pld_in[i] = rand() % 256;
+    for (uint8_t i = 0; i < sizeof(lsf_t); i++)
+        ((uint8_t*)&lsf_in)[i] = rand() % 256;
+
+    // noise, preamble, LSF, 2 stream frames, packet frame, BERT frame, EOT, noise
+    for (; cnt < lead; cnt++)
+        symbs[cnt] = (float)rand() / RAND_MAX * 2.0f - 1.0f;
+    gen_preamble(symbs, &cnt, PREAM_LSF);
+    gen_frame(&symbs[cnt], NULL, FRAME_LSF, &lsf_in, 0, 0); cnt += SYM_PER_FRA;
+    gen_frame(&symbs[cnt], pld_in, FRAME_STR, &lsf_in, 0, 0); cnt += SYM_PER_FRA;
+    gen_frame(&symbs[cnt], pld_in, FRAME_STR, &lsf_in, 1, 1); cnt += SYM_PER_FRA;
+    gen_frame(&symbs[cnt], pld_in, FRAME_PKT, NULL, 0, 0); cnt += SYM_PER_FRA;
+    gen_frame(&symbs[cnt], pld_in, FRAME_BERT, NULL, 0, 0); cnt += SYM_PER_FRA;
+    gen_eot(symbs, &cnt);
+    for (; cnt < sizeof(symbs) / sizeof(float); cnt++)
+        symbs[cnt] = (float)rand() / RAND_MAX * 2.0f - 1.0f;
+    for (uint32_t i = lead; i < cnt; i++)
+        symbs[i] += ((float)rand() / RAND_MAX - 0.5f) * 0.4f;
+
+    for (uint8_t k = 0; k < 2; k++)
+    {
+        memset(&log, 0, sizeof(log));
+        sync_detect_init(&det, M17_SYNC_DIST_MAX, sync_log_cb, &log);
+
+        uint32_t hits = 0;
+        if (k == 0)
+            hits = sync_detect(&det, symbs, cnt);
+        else
+        {
+            // any split of the input gives the same hits
+            uint32_t pos = 0;
+            while (pos < cnt)
+            {
+                uint32_t len = rand() % 300 + 1;
+                if (len > cnt - pos)
+                    len = cnt - pos;
+                hits += sync_detect(&det, &symbs[pos], len);
+                pos += len;
+            }
+        }
+
+        TEST_ASSERT_EQUAL_UINT32(6, hits);
+        TEST_ASSERT_EQUAL_UINT8(6, log.n);
+        for (uint8_t i = 0; i < 6; i++)
+        {
+            TEST_ASSERT_EQUAL(types[i], log.hit[i].type);
+            TEST_ASSERT_EQUAL_UINT32(lead + (i + 1) * SYM_PER_FRA, log.hit[i].offset);
+            TEST_ASSERT_TRUE(log.hit[i].dist < 1.0f);
+        }
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(&lsf_in, &log.lsf, sizeof(lsf_t));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(pld_in, log.pld[1], 16);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(pld_in, log.pld[2], 16);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(pld_in, log.pld[3], 25);
+    }
+
+    // noise only
+    sync_detect_reset(&det);
+    TEST_ASSERT_EQUAL_UINT32(0, sync_detect(&det, symbs, lead));
+}
+
+void sync_tracking(void)
+{
+    const uint32_t lead = 50;
+    float symbs[50 + 13*SYM_PER_FRA + 1];
+    uint8_t pld_in[16];
+    uint32_t fra[8], cnt = 0;
+    lsf_t lsf_in;
+    sync_detect_t det;
+    sync_log_t log;
+
+    for (uint8_t i = 0; i < sizeof(pld_in); i++)
+        pld_in[i] = rand() % 256;
+    for (uint8_t i = 0; i < sizeof(lsf_t); i++)
+        ((uint8_t*)&lsf_in)[i] = rand() % 256;
+
+    // LSF and 6 stream frames, the 3rd stream syncword is lost and the 5th frame comes a symbol late
+    for (; cnt < lead; cnt++)
+        symbs[cnt] = (float)rand() / RAND_MAX * 2.0f - 1.0f;
+    gen_preamble(symbs, &cnt, PREAM_LSF);
+    fra[0] = cnt;
+    gen_frame(&symbs[cnt], NULL, FRAME_LSF, &lsf_in, 0, 0); cnt += SYM_PER_FRA;
+    for (uint8_t i = 0; i < 6; i++)
+    {
+        if (i == 4)
+            symbs[cnt++] = 0.0f;
+        fra[i + 1] = cnt;
+        gen_frame(&symbs[cnt], pld_in, FRAME_STR, &lsf_in, i % 6, i); cnt += SYM_PER_FRA;
+    }
+    memset(&symbs[fra[3]], 0, SYM_PER_SWD * sizeof(float));
+    for (; cnt < sizeof(symbs) / sizeof(float); cnt++)
+        symbs[cnt] = (float)rand() / RAND_MAX * 2.0f - 1.0f;
+
+    memset(&log, 0, sizeof(log));
+    sync_detect_init(&det, M17_SYNC_DIST_MAX, sync_log_cb, &log);
+    TEST_ASSERT_EQUAL_INT8(-1, sync_detect_set_tracking(&det, M17_SYNC_TRACK_WIN_MAX + 1, 1));
+    TEST_ASSERT_EQUAL(SYNC_ACQUIRE, det.mode);
+
+    // locks on the LSF, rides through the lost syncword and the slip
+    TEST_ASSERT_EQUAL_UINT32(2, sync_detect(&det, symbs, fra[2] + SYM_PER_FRA));
+    TEST_ASSERT_EQUAL(SYNC_TRACK, det.mode);
+    TEST_ASSERT_EQUAL_UINT32(4, sync_detect(&det, &symbs[fra[2] + SYM_PER_FRA], fra[6] + SYM_PER_FRA + 2 - (fra[2] + SYM_PER_FRA)));
+    TEST_ASSERT_EQUAL(SYNC_TRACK, det.mode);
+    TEST_ASSERT_EQUAL_UINT8(6, log.n);
+    for (uint8_t i = 0; i < 6; i++)
+    {
+        TEST_ASSERT_EQUAL(i ? SWD_STR : SWD_LSF, log.hit[i].type);
+        TEST_ASSERT_EQUAL_UINT32(fra[i < 3 ? i : i + 1], log.hit[i].offset);
+    }
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(pld_in, log.pld[5], 16);
+
+    // carrier lost - back to acquisition after M17_SYNC_TRACK_MISSES frames
+    sync_detect(&det, &symbs[fra[6] + SYM_PER_FRA + 2], cnt - (fra[6] + SYM_PER_FRA + 2));
+    TEST_ASSERT_EQUAL(SYNC_ACQUIRE, det.mode);
+    TEST_ASSERT_EQUAL_UINT8(6, log.n);
+
+    // tracking disabled - consecutive frames are still found, but the detector never locks
+    // (past the lost syncword, payload data may occasionally look like a syncword)
+    memset(&log, 0, sizeof(log));
+    sync_detect_init(&det, M17_SYNC_DIST_MAX, sync_log_cb, &log);
+    TEST_ASSERT_EQUAL_INT8(0, sync_detect_set_tracking(&det, 0, 0));
+    sync_detect(&det, symbs, cnt);
+    TEST_ASSERT_EQUAL(SYNC_ACQUIRE, det.mode);
+    for (uint8_t i = 0; i < 3; i++)
+        TEST_ASSERT_EQUAL_UINT32(fra[i], log.hit[i].offset);
+}
+
 int main(void)
 {
     srand(time(NULL));
@@ -1169,9 +2505,13 @@ int main(void)
 
     //soft logic arithmetic
     RUN_TEST(soft_logic_xor);
+    RUN_TEST(soft_logic_arrays);
+    RUN_TEST(llr_negation);
 
     //symbol to dibit
     RUN_TEST(symbol_to_dibit);
+    RUN_TEST(symbol_to_dibit_exact);
+    RUN_TEST(symbol_to_dibit_fused);
 
     //soft Golay
     RUN_TEST(golay_encode);
@@ -1210,6 +2550,12 @@ int main(void)
     RUN_TEST(golay_soft_decode_flipped_4);
     RUN_TEST(golay_soft_decode_erased_5);
     RUN_TEST(golay_soft_decode_flipped_5);
+    RUN_TEST(golay_hard_decode_table);
+    RUN_TEST(golay_soft_decode_confident_3);
+    RUN_TEST(golay_ml_decode);
+    RUN_TEST(golay_ct_decode);
+    RUN_TEST(lich_decode_batch);
+    RUN_TEST(lich_decode_cached);
 
     //Viterbi
     RUN_TEST(viterbi_stream_roundtrip_clean);
@@ -1218,6 +2564,22 @@ int main(void)
     RUN_TEST(viterbi_stream_burst_error);
     RUN_TEST(viterbi_stream_excessive_errors);
     RUN_TEST(viterbi_stream_zero_cost);
+    RUN_TEST(viterbi_ctx_interleaved);
+    RUN_TEST(viterbi_kernels_bit_exact);
+    RUN_TEST(viterbi_batch_bit_exact);
+    RUN_TEST(viterbi_punctured_inline);
+    RUN_TEST(viterbi_stream_long);
+    RUN_TEST(viterbi_stream_punctured);
+    RUN_TEST(viterbi_hard_decision);
+    RUN_TEST(viterbi_hard_fallback);
+    RUN_TEST(viterbi_shortcut);
+    RUN_TEST(viterbi_sova_lsf);
+    RUN_TEST(viterbi_llr_frames);
+
+    //packed convolutional encoders
+    RUN_TEST(conv_encode_packed_frames);
+    RUN_TEST(gen_frame_fused);
+    RUN_TEST(reorder_randomize_packed);
 
     //packet frame encode-decode
     RUN_TEST(lsf_encode_decode);
@@ -1232,6 +2594,16 @@ int main(void)
 
     //CRC test vectors
     RUN_TEST(crc_checks);
+    RUN_TEST(crc_chase);
+
+    //RRC filters
+    RUN_TEST(rrc_interpolator);
+    RUN_TEST(rrc_decimator);
+    RUN_TEST(symbol_sync_recovery);
+
+    //frame sync
+    RUN_TEST(sync_detector);
+    RUN_TEST(sync_tracking);
 
     return UNITY_END();
 }